@@ -0,0 +1,175 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Archive class - Header file.
+
+// Define guard.
+#ifndef ASSET_ARCHIVE_H_
+#define ASSET_ARCHIVE_H_
+
+// Includes.
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+// POSIX includes.
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// SDL2 includes.
+#include <SDL2/SDL_rwops.h>
+
+// User includes.
+#include "AssetManifest.hpp"
+#include "RawTexture.hpp"
+
+// Template includes.
+#include "templates/ErrorDescription.hpp"
+#include "templates/RuntimeException.hpp"
+
+// Declarations.
+class AssetArchive;
+enum AssetArchiveErrorCode : unsigned short;
+class AssetArchiveErrorDescription;
+class AssetArchiveException;
+struct AssetArchiveHeader;
+struct AssetArchiveIndexEntry;
+struct AssetPackOptions;
+
+// Macros.
+#define ASSET_ARCHIVE_DATA_ALIGNMENT 16
+#define ASSET_ARCHIVE_ID_SIZE 48
+#define ASSET_ARCHIVE_MAGIC "AAPAK001"
+#define ASSET_ARCHIVE_MAGIC_SIZE 8
+#define ASSET_ARCHIVE_VERSION 1
+
+// Enumeration definitions.
+enum AssetArchiveErrorCode : unsigned short {
+  OpenAssetArchiveError = 1,
+  InvalidAssetArchiveError,
+  LongAssetIdError,
+  ReadAssetFileError,
+  WriteAssetArchiveError,
+  ConvertTextureError
+};
+
+// Type definitions.
+// Layout: header, then each asset's bytes (aligned), then the index.
+struct AssetArchiveHeader {
+  char magic[ASSET_ARCHIVE_MAGIC_SIZE];
+  uint32_t version;
+  uint32_t entry_count;
+  uint64_t index_offset;
+};
+
+struct AssetArchiveIndexEntry {
+  char id[ASSET_ARCHIVE_ID_SIZE];
+  uint32_t kind;
+  uint32_t reserved;
+  uint64_t data_offset;
+  uint64_t data_size;
+};
+
+struct AssetPackOptions {
+  bool raw_textures;
+  RawTextureCompression texture_compression;
+};
+
+// Auxiliary class definitions.
+class AssetArchiveErrorDescription :
+  public ErrorDescription<AssetArchiveErrorCode>
+{
+  // Public components.
+  public:
+
+    // Inherited methods.
+    using ErrorDescription::ErrorDescription;
+
+    // Method prototypes.
+    std::string describeErrorCause(
+      AssetArchiveErrorCode error_code
+    ) const noexcept override;
+    std::string describeErrorDetails(
+      AssetArchiveErrorCode error_code
+    ) const noexcept override;
+    std::string describeErrorSummary() const noexcept override;
+};
+
+// Exception definitions.
+class AssetArchiveException :
+  public RuntimeException<AssetArchiveErrorCode, AssetArchiveErrorDescription>
+{
+  // Public components.
+  public:
+
+    // Inherited methods.
+    using RuntimeException::RuntimeException;
+};
+
+// Class definition.
+class AssetArchive {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    AssetArchive(const AssetManifest& asset_manifest) noexcept;
+    ~AssetArchive() noexcept;
+
+    // Method prototypes.
+    void close() noexcept;
+    bool contains(const std::string& id) const noexcept;
+    int findAsset(
+      const std::string& id,
+      const unsigned char*& asset_data,
+      size_t& asset_size
+    ) const noexcept;
+    bool isOpen() const noexcept;
+    void open(const std::string& archive_file);
+    SDL_RWops* openAsset(const std::string& id) const noexcept;
+    size_t size() const noexcept;
+
+    // Static method prototypes.
+    static size_t pack(
+      const AssetManifest& asset_manifest,
+      const std::string& archive_file,
+      const AssetPackOptions& pack_options = {}
+    );
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    AssetArchive(const AssetArchive&) = delete;
+
+    // Members.
+    const AssetManifest& asset_manifest;
+    std::map<std::string, AssetArchiveIndexEntry> index;
+    const unsigned char* mapped_data = nullptr;
+    size_t mapped_size = 0;
+
+    // Default operator overloadings.
+    AssetArchive& operator = (const AssetArchive&) = delete;
+
+    // Method prototypes.
+    int readIndex() noexcept;
+
+    // Static method prototypes.
+    static uint64_t alignedOffset(uint64_t offset) noexcept;
+    static void padToOffset(std::ofstream& archive_stream, uint64_t offset);
+    static void readAssetData(
+      const AssetManifestEntry& entry,
+      const AssetPackOptions& pack_options,
+      std::vector<unsigned char>& asset_data
+    );
+};
+
+#endif // ASSET_ARCHIVE_H_
@@ -0,0 +1,144 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Loader class - Header file.
+
+// Define guard.
+#ifndef ASSET_LOADER_H_
+#define ASSET_LOADER_H_
+
+// Includes.
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_error.h>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_mixer.h>
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_surface.h>
+#include <SDL2/SDL_timer.h>
+
+// User includes.
+#include "AssetArchive.hpp"
+#include "AssetManifest.hpp"
+#include "Music.hpp"
+#include "SoundChunkCache.hpp"
+#include "TextureCache.hpp"
+
+// Template includes.
+#include "templates/AssetHandle.hpp"
+
+// Declarations.
+class AssetLoader;
+struct AssetLoadJob;
+
+// Macros.
+#define ASSET_LOADER_FRAME_UPLOAD_BUDGET 0.002
+#define ASSET_LOADER_MAX_WORKER_COUNT 4
+#define ASSET_LOADER_WAIT_SLICE_MS 1
+
+// Type definitions.
+struct AssetLoadJob {
+  AssetKind kind;
+  std::string id;
+  SDL_Renderer* renderer;
+  MusicHandle music_handle;
+  SoundChunkHandle sound_chunk_handle;
+  TextureHandle texture_handle;
+  Mix_Chunk* decoded_chunk;
+  Mix_Music* decoded_music;
+  SDL_Surface* decoded_surface;
+  std::string decode_error;
+  double decode_time;
+};
+
+// Class definition.
+class AssetLoader {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    AssetLoader(
+      const AssetArchive& asset_archive,
+      TextureCache& texture_cache,
+      SoundChunkCache& sound_chunk_cache
+    );
+    ~AssetLoader() noexcept;
+
+    // Method prototypes.
+    size_t countPendingLoads() const noexcept;
+    unsigned long getCompletedLoadCount() const noexcept;
+    unsigned long getRequestedLoadCount() const noexcept;
+    void requestManifestAssets(
+      const AssetManifest& manifest,
+      SDL_Renderer* renderer
+    );
+    MusicHandle requestMusic(const std::string& id);
+    SoundChunkHandle requestSoundChunk(const std::string& id);
+    TextureHandle requestTexture(
+      SDL_Renderer* renderer,
+      const std::string& id
+    );
+    size_t uploadDecodedAssets(double time_budget) noexcept;
+    void wait(const MusicHandle& music_handle) noexcept;
+    void wait(const SoundChunkHandle& sound_chunk_handle) noexcept;
+    void wait(const TextureHandle& texture_handle) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    AssetLoader(const AssetLoader&) = delete;
+
+    // Members.
+    const AssetArchive& asset_archive;
+    unsigned long completed_loads = 0;
+    std::condition_variable decoded_condition;
+    std::deque<AssetLoadJob> decoded_jobs;
+    std::atomic<unsigned long> failed_worker_jobs{0};
+    std::map<std::string, SoundChunkHandle> in_flight_sound_chunks;
+    std::map<TextureCacheKey, TextureHandle> in_flight_textures;
+    std::mutex jobs_mutex;
+    std::condition_variable pending_condition;
+    std::deque<AssetLoadJob> pending_jobs;
+    unsigned long requested_loads = 0;
+    SoundChunkCache& sound_chunk_cache;
+    bool stop_requested = false;
+    TextureCache& texture_cache;
+    std::vector<std::thread> workers;
+
+    // Default operator overloadings.
+    AssetLoader& operator = (const AssetLoader&) = delete;
+
+    // Method prototypes.
+    void completeJob(AssetLoadJob& job) noexcept;
+    void completeMusicJob(AssetLoadJob& job) noexcept;
+    void completeSoundChunkJob(AssetLoadJob& job) noexcept;
+    void completeTextureJob(AssetLoadJob& job) noexcept;
+    void decodeJob(AssetLoadJob& job) const noexcept;
+    void enqueueJob(AssetLoadJob job);
+    void failJob(AssetLoadJob& job) noexcept;
+    bool popDecodedJob(AssetLoadJob& job) noexcept;
+    void runWorker() noexcept;
+    void waitForDecodedJobs() noexcept;
+
+    // Static method prototypes.
+    static unsigned int defaultWorkerCount() noexcept;
+    static void freeDecodedData(AssetLoadJob& job) noexcept;
+};
+
+#endif // ASSET_LOADER_H_
@@ -0,0 +1,117 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Manifest class - Header file.
+
+// Define guard.
+#ifndef ASSET_MANIFEST_H_
+#define ASSET_MANIFEST_H_
+
+// Includes.
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Template includes.
+#include "templates/ErrorDescription.hpp"
+#include "templates/RuntimeException.hpp"
+
+// Declarations.
+enum AssetKind : unsigned short;
+class AssetManifest;
+enum AssetManifestErrorCode : unsigned short;
+class AssetManifestErrorDescription;
+class AssetManifestException;
+struct AssetManifestEntry;
+
+// Enumeration definitions.
+enum AssetKind : unsigned short {
+  MusicAsset,
+  SoundChunkAsset,
+  TextureAsset
+};
+
+enum AssetManifestErrorCode : unsigned short {
+  ReadAssetManifestError = 1,
+  ParseAssetManifestError,
+  DuplicateAssetIdError,
+  UnknownAssetIdError
+};
+
+// Type definitions.
+struct AssetManifestEntry {
+  AssetKind kind;
+  std::string id;
+  std::string file;
+};
+
+// Auxiliary class definitions.
+class AssetManifestErrorDescription :
+  public ErrorDescription<AssetManifestErrorCode>
+{
+  // Public components.
+  public:
+
+    // Inherited methods.
+    using ErrorDescription::ErrorDescription;
+
+    // Method prototypes.
+    std::string describeErrorCause(
+      AssetManifestErrorCode error_code
+    ) const noexcept override;
+    std::string describeErrorDetails(
+      AssetManifestErrorCode error_code
+    ) const noexcept override;
+    std::string describeErrorSummary() const noexcept override;
+};
+
+// Exception definitions.
+class AssetManifestException :
+  public RuntimeException<AssetManifestErrorCode, AssetManifestErrorDescription>
+{
+  // Public components.
+  public:
+
+    // Inherited methods.
+    using RuntimeException::RuntimeException;
+};
+
+// Class definition.
+class AssetManifest {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    AssetManifest() noexcept = default;
+    AssetManifest(const std::string& manifest_file);
+
+    // Method prototypes.
+    void addEntry(
+      AssetKind kind,
+      const std::string& id,
+      const std::string& file
+    );
+    bool contains(const std::string& id) const noexcept;
+    const std::vector<AssetManifestEntry>& getEntries() const noexcept;
+    void open(const std::string& manifest_file);
+    const std::string& pathOf(const std::string& id) const;
+    size_t size() const noexcept;
+
+  // Private components.
+  private:
+
+    // Members.
+    std::map<std::string, size_t> entry_indices;
+    std::vector<AssetManifestEntry> entries;
+
+    // Static method prototypes.
+    static int parseAssetKind(
+      const std::string& kind_name,
+      AssetKind& kind
+    ) noexcept;
+};
+
+#endif // ASSET_MANIFEST_H_
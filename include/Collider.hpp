@@ -0,0 +1,64 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Collider class - Header file.
+
+// Define guard.
+#ifndef COLLIDER_H_
+#define COLLIDER_H_
+
+// SDL2 includes.
+#include <SDL2/SDL_render.h>
+
+// User includes.
+#include "GameObject.hpp"
+
+// Template includes.
+#include "templates/PoolAllocated.hpp"
+
+// Declarations.
+class Collider;
+
+// Macros.
+#define COLLIDER_ALL_LAYERS 0xFFFFFFFFu
+#define COLLIDER_DEFAULT_LAYER 0x1u
+
+// Class definition.
+// Marks its game object as solid. Two colliders touch only when each one's
+// layer is in the other's mask.
+class Collider : public Component, public PoolAllocated<Collider> {
+  // Public components.
+  public:
+
+    // Static members.
+    static constexpr bool has_render_work = false;
+    static constexpr bool has_update_work = false;
+    static constexpr ComponentType component_type = \
+      ComponentType::ColliderComponent;
+    static constexpr bool updates_shared_state = false;
+
+    // Class method prototypes.
+    Collider(
+      GameObject& associated,
+      unsigned int layer = COLLIDER_DEFAULT_LAYER,
+      unsigned int mask = COLLIDER_ALL_LAYERS
+    );
+
+    // Method prototypes.
+    bool acceptsCollisionWith(const Collider& other) const noexcept;
+    unsigned int getLayer() const noexcept;
+    unsigned int getMask() const noexcept;
+    void render(SDL_Renderer* renderer) noexcept override;
+    void setLayer(unsigned int layer) noexcept;
+    void setMask(unsigned int mask) noexcept;
+    void update(double dt) noexcept override;
+
+  // Private components.
+  private:
+
+    // Members.
+    unsigned int layer;
+    unsigned int mask;
+};
+
+#endif // COLLIDER_H_
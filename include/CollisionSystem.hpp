@@ -0,0 +1,111 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Collision System class - Header file.
+
+// Define guard.
+#ifndef COLLISION_SYSTEM_H_
+#define COLLISION_SYSTEM_H_
+
+// Includes.
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// User includes.
+#include "Collider.hpp"
+#include "GameObject.hpp"
+#include "Rectangle.hpp"
+
+// Declarations.
+struct CollisionPair;
+struct CollisionStatistics;
+class CollisionSystem;
+struct SweepEntry;
+
+// Macros.
+#define COLLISION_SWEEP_BAND_EXTENT_FACTOR 4
+
+// Type definitions.
+// Spawn orders are copied in, so sorting pairs never touches the objects.
+struct CollisionPair {
+  unsigned long first_spawn_order;
+  unsigned long second_spawn_order;
+  GameObject* first;
+  GameObject* second;
+};
+
+struct CollisionStatistics {
+  unsigned long colliders;
+  unsigned long broadphase_pairs;
+  unsigned long collisions;
+};
+
+// Bounds are stored along the sweep axis and across it, whichever that is.
+struct SweepEntry {
+  double sweep_min;
+  double sweep_max;
+  double cross_min;
+  double cross_max;
+  unsigned long spawn_order;
+  Collider* collider;
+};
+
+// Class definition.
+// Sort and sweep broadphase over the boxes of every living game object with
+// a Collider, followed by an exact box test. The world is cut into bands
+// across the sweep axis and each band is sorted and swept alone, so the
+// candidates per object stay flat as the world fills up. Pairs are found
+// first and only then delivered, so responses never disturb the sweep.
+class CollisionSystem {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    CollisionSystem() noexcept = default;
+
+    // Method prototypes.
+    void deliverCollisions();
+    size_t detectCollisions(
+      const std::vector<std::unique_ptr<GameObject>>& game_objects
+    );
+    const std::vector<CollisionPair>& getCollisionPairs() const noexcept;
+    const CollisionStatistics& getStatistics() const noexcept;
+    void update(const std::vector<std::unique_ptr<GameObject>>& game_objects);
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    CollisionSystem(const CollisionSystem&) = delete;
+
+    // Members.
+    std::vector<SweepEntry> band_entries;
+    double band_origin = 0;
+    double band_size = 1;
+    std::vector<size_t> band_starts;
+    std::vector<CollisionPair> collision_pairs;
+    CollisionStatistics statistics = {};
+    std::vector<SweepEntry> sweep_entries;
+
+    // Default operator overloadings.
+    CollisionSystem& operator = (const CollisionSystem&) = delete;
+
+    // Method prototypes.
+    size_t bandOf(double cross_coordinate) const noexcept;
+    void bucketEntriesByBand();
+    void gatherSweepEntries(
+      const std::vector<std::unique_ptr<GameObject>>& game_objects
+    );
+    void sortCollisionPairs();
+    void sweepBand(size_t band);
+
+    // Static method prototypes.
+    static bool entriesOverlap(
+      const SweepEntry& lhs,
+      const SweepEntry& rhs
+    ) noexcept;
+};
+
+#endif // COLLISION_SYSTEM_H_
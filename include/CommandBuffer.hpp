@@ -0,0 +1,96 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Command Buffer class - Header file.
+
+// Define guard.
+#ifndef COMMAND_BUFFER_H_
+#define COMMAND_BUFFER_H_
+
+// Includes.
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// User includes.
+#include "GameObject.hpp"
+
+// Declarations.
+class CommandBuffer;
+struct StructuralCommand;
+enum StructuralCommandType : unsigned short;
+
+// Enumeration definitions.
+enum StructuralCommandType : unsigned short {
+  AddComponentCommand,
+  DespawnCommand,
+  RemoveComponentCommand,
+  SpawnCommand,
+  TransitionStateCommand
+};
+
+// Type definitions.
+using GameObjectFactory = std::function<void(GameObject& game_object)>;
+using GameObjectSpawner = std::function<void(GameObject* game_object)>;
+
+// Only despawns and state transitions set the state, the rest leave it out.
+struct StructuralCommand {
+  StructuralCommandType type;
+  GameObject* target;
+  ComponentType component_type;
+  GameObjectState state;
+  GameObjectFactory factory;
+};
+
+// Class definition.
+class CommandBuffer {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    CommandBuffer() = default;
+
+    // Method prototypes.
+    void addComponent(GameObject& target, GameObjectFactory factory);
+    size_t countPendingCommands() const noexcept;
+    void despawn(GameObject& target);
+    size_t flush(const GameObjectSpawner& spawner) noexcept;
+    size_t getLastFlushSize() const noexcept;
+    void removeComponent(GameObject& target, ComponentType component_type);
+    void spawn(GameObjectFactory factory);
+    void transitionState(GameObject& target, GameObjectState state);
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    CommandBuffer(const CommandBuffer&) = delete;
+
+    // Members.
+    std::vector<StructuralCommand> commands;
+    mutable std::mutex commands_mutex;
+    std::vector<StructuralCommand> flushing_commands;
+    size_t last_flush_size = 0;
+
+    // Default operator overloadings.
+    CommandBuffer& operator = (const CommandBuffer&) = delete;
+
+    // Method prototypes.
+    void applyCommand(
+      StructuralCommand& command,
+      const GameObjectSpawner& spawner
+    );
+    void record(StructuralCommand command);
+
+    // Static method prototypes.
+    static void applyStateTransition(
+      GameObject& target,
+      GameObjectState state
+    );
+};
+
+#endif // COMMAND_BUFFER_H_
@@ -0,0 +1,79 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Component Registry class - Header file.
+
+// Define guard.
+#ifndef COMPONENT_REGISTRY_H_
+#define COMPONENT_REGISTRY_H_
+
+// Includes.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_render.h>
+
+// User includes.
+#include "GameObject.hpp"
+#include "SpriteBatch.hpp"
+
+// Declarations.
+class ComponentRegistry;
+struct RegisteredComponent;
+
+// Type definitions.
+struct RegisteredComponent {
+  unsigned long spawn_order;
+  Component* component;
+};
+
+// Class definition.
+class ComponentRegistry {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    ComponentRegistry() noexcept = default;
+
+    // Method prototypes.
+    size_t countComponentsOfType(ComponentType type) const noexcept;
+    void registerComponent(Component* component);
+    void renderComponents(
+      SDL_Renderer* renderer,
+      SpriteBatch& sprite_batch,
+      double interpolation_factor,
+      unsigned long visibility_frame
+    );
+    void unregisterComponent(Component* component) noexcept;
+    void updateComponents(double dt);
+
+    // Static method prototypes.
+    static bool typeHasRenderWork(ComponentType type) noexcept;
+    static bool typeHasParallelUpdateWork(ComponentType type) noexcept;
+    static bool typeHasSerialUpdateWork(ComponentType type) noexcept;
+    static bool typeHasUpdateWork(ComponentType type) noexcept;
+    static bool typeUpdatesSharedState(ComponentType type) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    ComponentRegistry(const ComponentRegistry&) = delete;
+
+    // Members.
+    std::array<std::vector<RegisteredComponent>, ComponentTypeCount> pools;
+    std::array<size_t, ComponentTypeCount> vacant_entries = {};
+
+    // Default operator overloadings.
+    ComponentRegistry& operator = (const ComponentRegistry&) = delete;
+
+    // Method prototypes.
+    void compactPool(ComponentType type) noexcept;
+    void compactPools() noexcept;
+    void renumberPoolFrom(ComponentType type, size_t first_entry) noexcept;
+};
+
+#endif // COMPONENT_REGISTRY_H_
@@ -14,9 +14,13 @@
 #include <SDL2/SDL_render.h>
 
 // User includes.
+#include "CommandBuffer.hpp"
 #include "GameObject.hpp"
 #include "Sound.hpp"
 
+// Template includes.
+#include "templates/PoolAllocated.hpp"
+
 // Declarations.
 class Face;
 
@@ -24,10 +28,18 @@ class Face;
 #define DEFAULT_HITPOINTS 100
 
 // Class definition.
-class Face : public Component {
+class Face : public Component, public PoolAllocated<Face> {
   // Public components.
   public:
 
+    // Static members.
+    static constexpr bool has_render_work = false;
+    static constexpr bool has_update_work = false;
+    static constexpr ComponentType component_type = \
+      ComponentType::FaceComponent;
+    // Deaths play sounds and record commands, so updates stay serial.
+    static constexpr bool updates_shared_state = true;
+
     // Class method prototypes.
     Face(GameObject& associated);
 
@@ -0,0 +1,78 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Frame Pacer class - Header file.
+
+// Define guard.
+#ifndef FRAME_PACER_H_
+#define FRAME_PACER_H_
+
+// Includes.
+#include <string>
+#include <thread>
+
+// SDL2 includes.
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_timer.h>
+
+// Declarations.
+class FramePacer;
+enum PresentStrategy : unsigned short;
+
+// Macros.
+#define FRAME_PACER_LATE_LATCH_MARGIN 0.002
+#define FRAME_PACER_SPIN_THRESHOLD 0.002
+#define FRAME_PACER_WORK_TIME_SMOOTHING 0.125
+
+// Enumeration definitions.
+enum PresentStrategy : unsigned short {
+  SleepAfterPresent,
+  VSyncPresent,
+  LateLatchPresent,
+  UncappedPresent
+};
+
+// Class definition.
+class FramePacer {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    FramePacer(double frame_rate, PresentStrategy present_strategy) noexcept;
+
+    // Method prototypes.
+    void beginFrame() noexcept;
+    void endFrame() noexcept;
+    double getFrameRate() const noexcept;
+    double getPredictedWorkTime() const noexcept;
+    PresentStrategy getPresentStrategy() const noexcept;
+    void setFrameRate(double frame_rate) noexcept;
+    void setPresentStrategy(PresentStrategy present_strategy) noexcept;
+
+    // Static method prototypes.
+    static int parsePresentStrategy(
+      const std::string& name,
+      PresentStrategy& present_strategy
+    ) noexcept;
+    static const char* presentStrategyName(
+      PresentStrategy present_strategy
+    ) noexcept;
+
+  // Private components.
+  private:
+
+    // Members.
+    Uint64 frame_start_counter = 0;
+    double frame_rate;
+    Uint64 next_deadline_counter = 0;
+    Uint64 performance_frequency;
+    double predicted_work_time = 0;
+    PresentStrategy present_strategy;
+
+    // Method prototypes.
+    Uint64 frameBudgetCounter() const noexcept;
+    bool isFrameRateCapped() const noexcept;
+    void sleepUntil(Uint64 wake_counter) const noexcept;
+};
+
+#endif // FRAME_PACER_H_
@@ -21,10 +21,15 @@
 #include <SDL2/SDL_mixer.h>
 #include <SDL2/SDL_render.h>
 #include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_surface.h>
 #include <SDL2/SDL_timer.h>
+#include <SDL2/SDL_version.h>
 #include <SDL2/SDL_video.h>
 
 // User includes.
+#include "FramePacer.hpp"
+#include "JobSystem.hpp"
+#include "Profiler.hpp"
 #include "State.hpp"
 
 // Template includes.
@@ -36,6 +41,7 @@ class Game;
 enum GameInitErrorCode : unsigned short;
 class GameInitErrorDescription;
 class GameInitException;
+struct GameLoopParams;
 struct GameParams;
 enum GameRunErrorCode : unsigned short;
 class GameRunErrorDescription;
@@ -46,6 +52,12 @@ struct SDLRendererParams;
 struct SDLWindowParams;
 
 // Macros.
+#define GAME_FRAME_RATE 30
+#define GAME_HEADLESS_AUDIO_DRIVER "dummy"
+#define GAME_HEADLESS_PIXEL_FORMAT SDL_PIXELFORMAT_ARGB8888
+#define GAME_HEADLESS_VIDEO_DRIVER "dummy"
+#define GAME_MAX_FRAME_DURATION 0.25
+#define GAME_SIMULATION_RATE 60
 #define GAME_WINDOW_TITLE "AlienAttack"
 #define GAME_WINDOW_HEIGHT 600
 #define GAME_WINDOW_WIDTH 1024
@@ -68,10 +80,18 @@ enum GameRunErrorCode : unsigned short {
 };
 
 // Type definitions.
+struct GameLoopParams {
+  double simulation_rate;
+  double frame_rate;
+  PresentStrategy present_strategy;
+};
+
 struct GameParams {
   std::string title;
   int width;
   int height;
+  GameLoopParams loop_params;
+  bool headless;
 };
 
 struct SDLAudioParams {
@@ -96,6 +116,7 @@ struct SDLWindowParams {
 };
 
 struct SDLConfig {
+  bool headless;
   Uint32 SDL_flags;
   int image_flags;
   int mixer_flags;
@@ -172,10 +193,17 @@ class Game {
     // Method prototypes.
     SDL_Renderer* getRenderer() noexcept;
     State& getState() noexcept;
+    JobSystem& getJobSystem() noexcept;
+    double getTimeToFirstFrame() const noexcept;
     void run();
+    const FramePacer& getFramePacer() const noexcept;
+    void setPresentStrategy(PresentStrategy present_strategy) noexcept;
+    void setTargetFrameRate(double frame_rate) noexcept;
 
     // Static method prototypes.
+    static GameParams defaultGameParams() noexcept;
     static Game& getInstance();
+    static Game& getInstance(GameParams game_params);
 
   // Private components.
   private:
@@ -185,8 +213,16 @@ class Game {
     Game(const Game&) = delete;
 
     // Members.
+    bool first_frame_presented = false;
+    FramePacer frame_pacer;
+    JobSystem job_system;
+    Uint64 launch_counter;
+    GameLoopParams loop_params;
+    Uint64 performance_frequency = 1;
     SDL_Renderer* renderer = nullptr;
+    SDL_Surface* render_target = nullptr;
     State* state = nullptr;
+    double time_to_first_frame = 0;
     SDL_Window* window = nullptr;
 
     // Static members.
@@ -201,21 +237,29 @@ class Game {
     void cleanUpGameState() noexcept;
     void cleanUpGameWindow() noexcept;
     void cleanUpSDLModules() noexcept;
+    double clampedFrameDuration(double frame_duration) const noexcept;
     SDLConfig defaultSDLConfig(GameParams game_params) const noexcept;
     void initGame(SDLConfig SDL_module_params);
     int initGameState() noexcept;
     void initRandomNumberGeneration() noexcept;
     int initSDL(Uint32 flags) noexcept;
     int initSDLAudio(SDLAudioParams audio_params, int audio_channels) noexcept;
+    int initSDLHeadlessDrivers() noexcept;
+    int initSDLHeadlessRenderer(SDLWindowParams window_params) noexcept;
     int initSDLImage(int flags) noexcept;
     int initSDLMix(int flags) noexcept;
     int initSDLRenderer(SDLRendererParams renderer_params) noexcept;
     int initSDLWindow(SDLWindowParams window_params) noexcept;
-    void renderAndPresentGameState();
+    void recordTimeToFirstFrame() noexcept;
+    void renderAndPresentGameState(double interpolation_factor);
+    double secondsElapsedBetween(
+      Uint64 start_counter,
+      Uint64 end_counter
+    ) const noexcept;
     bool shouldKeepRunning() const noexcept;
-    void updateGameState();
+    double simulationTimeStep() const noexcept;
+    void updateGameState(double dt);
     int verifySingletonProperty() const noexcept;
-    void waitTimeIntervalBetweenFrames() const noexcept;
 };
 
 #endif // GAME_H_
@@ -9,27 +9,40 @@
 
 // Includes.
 #include <algorithm>
+#include <array>
+#include <exception>
+#include <iostream>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 // SDL2 includes.
 #include <SDL2/SDL_render.h>
 
 // User includes.
+#include "JobSystem.hpp"
 #include "Rectangle.hpp"
+#include "SpatialGrid.hpp"
 #include "VectorR2.hpp"
 
+// Template includes.
+#include "templates/PoolAllocated.hpp"
+
 // Declarations.
+class CommandBuffer;
 class Component;
+class ComponentRegistry;
 enum ComponentType : unsigned short;
 class GameObject;
 enum GameObjectState : unsigned short;
 
 // Enumeration definitions.
 enum ComponentType : unsigned short {
+  ColliderComponent,
   FaceComponent,
   SoundComponent,
-  SpriteComponent
+  SpriteComponent,
+  ComponentTypeCount
 };
 
 enum GameObjectState : unsigned short {
@@ -59,11 +72,17 @@ class Component {
 
     // Method prototypes.
     void attachToAssociatedGameObject();
+    GameObject& getAssociated() const noexcept;
+    size_t getRegistryEntry() const noexcept;
+    ComponentType getType() const noexcept;
     bool is(ComponentType type) const noexcept;
+    void setRegistryEntry(size_t registry_entry) noexcept;
     
     // Virtual method prototypes.
+    virtual void notifyCollision(GameObject& other);
     virtual void render(SDL_Renderer* renderer) = 0;
     virtual void update(double dt) = 0;
+    virtual void updateInParallel(double dt, JobSystem& job_system);
 
   // Protected components.
   protected:
@@ -75,48 +94,109 @@ class Component {
   private:
 
     // Members.
+    size_t registry_entry = 0;
     ComponentType type;
 };
 
 // Class definition.
-class GameObject {
+class GameObject : public PoolAllocated<GameObject> {
   // Public components.
   public:
-    
+
+    // Class method prototypes.
+    GameObject();
+    ~GameObject() noexcept;
+
     // Members.
     Rectangle box;
 
     // Method prototypes.
     void addComponent(Component* new_component);
+    void attachToCommandBuffer(CommandBuffer* command_buffer) noexcept;
+    void attachToComponentRegistry(ComponentRegistry* component_registry);
+    void attachToSpatialIndex(SpatialGrid* spatial_index);
+    bool deathWasRecorded() const noexcept;
     bool deletionWasRequested() const noexcept;
+    CommandBuffer* getCommandBuffer() const noexcept;
     Component* getComponent(ComponentType type) noexcept;
+    const Rectangle& getRenderBox() const noexcept;
+    unsigned long getSpawnOrder() const noexcept;
     GameObjectState getState() const noexcept;
     bool hasComponentType(ComponentType type) const noexcept;
     bool isAlive() const noexcept;
+    bool isVisibleInFrame(unsigned long frame) const noexcept;
+    void markVisibleInFrame(unsigned long frame) noexcept;
+    void notifyCollision(GameObject& other);
+    void recordDeath() noexcept;
+    void recordPreviousBox() noexcept;
     void removeComponent(Component* component_to_remove);
     void removeComponent(ComponentType removal_target_type);
-    void render(SDL_Renderer* renderer);
+    void render(SDL_Renderer* renderer, double interpolation_factor);
     void requestDeletion() noexcept;
     void resolveDeath();
     void setCenterCoordinates(const VectorR2& center_coordinates) noexcept;
     void setDimensions(double width, double height) noexcept;
+    void setSpawnOrder(unsigned long spawn_order) noexcept;
+    Rectangle sweptBox() const noexcept;
     void update(double dt);
+    void updateInParallel(double dt, JobSystem& job_system);
+    void updateRenderBox(double interpolation_factor) noexcept;
+
+    // Template method prototypes.
+    template <class TComponent> TComponent* getComponent() noexcept;
 
   // Private components.
   private:
 
+    // Class method prototypes.
+    GameObject(const GameObject&) = delete;
+
     // Members.
+    CommandBuffer* command_buffer = nullptr;
+    unsigned int component_mask = 0;
+    std::array<Component*, ComponentTypeCount> component_slots = {};
+    ComponentRegistry* component_registry = nullptr;
     std::vector<std::unique_ptr<Component>> components;
+    // Set as soon as death is decided, ahead of the deferred state change.
+    bool death_recorded = false;
+    Rectangle previous_box;
+    bool previous_box_recorded = false;
+    Rectangle render_box;
+    SpatialGrid* spatial_index = nullptr;
+    unsigned long spawn_order = 0;
     GameObjectState state = AliveState;
+    unsigned long visible_frame = 0;
+
+    // Default operator overloadings.
+    GameObject& operator = (const GameObject&) = delete;
 
     // Method prototypes.
     void eraseComponentAtPosition(component_const_iter removal_position);
+    Rectangle interpolatedBox(double interpolation_factor) const noexcept;
+    void refreshComponentSlot(ComponentType type) noexcept;
     component_const_iter searchComponentsByType(
       ComponentType search_parameter
     ) const noexcept;
     component_const_iter searchComponentsByValue(
       Component* search_parameter
     ) const noexcept;
+    void updateSpatialIndex() noexcept;
+
+    // Static method prototypes.
+    static unsigned int componentTypeBit(ComponentType type) noexcept;
+};
+
+// Template method implementations.
+template <class TComponent>
+TComponent* GameObject::getComponent() noexcept {
+  static_assert(
+    std::is_base_of<Component, TComponent>::value,
+    "TComponent must be derived from Component."
+  );
+
+  return static_cast<TComponent*>(
+    this->component_slots[TComponent::component_type]
+  );
 };
 
 #endif // GAME_OBJECT_H_
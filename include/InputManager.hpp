@@ -0,0 +1,115 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Input Manager class - Header file.
+
+// Define guard.
+#ifndef INPUT_MANAGER_H_
+#define INPUT_MANAGER_H_
+
+// Includes.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_events.h>
+#include <SDL2/SDL_keyboard.h>
+#include <SDL2/SDL_mouse.h>
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_timer.h>
+
+// User includes.
+#include "VectorR2.hpp"
+
+// Declarations.
+struct InputEvent;
+enum InputEventType : unsigned short;
+struct InputLatencyStatistics;
+class InputManager;
+
+// Macros.
+#define INPUT_MANAGER_RING_BUFFER_SIZE 256
+
+// Enumeration definitions.
+enum InputEventType : unsigned short {
+  KeyDownInput,
+  MouseButtonDownInput,
+  MouseMotionInput,
+  QuitInput,
+  InputEventTypeCount
+};
+
+// Type definitions.
+struct InputEvent {
+  InputEventType type;
+  Uint32 timestamp;
+  Uint64 origin_counter;
+  VectorR2 coordinates;
+  SDL_Keysym keysym;
+  Uint8 button;
+};
+
+struct InputLatencyStatistics {
+  double last_latency;
+  double max_latency;
+  double mean_latency;
+  unsigned long presented_events;
+};
+
+using InputSubscriber = std::function<void(
+  const std::vector<InputEvent>& events
+)>;
+
+// Class definition.
+class InputManager {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    InputManager() noexcept;
+
+    // Method prototypes.
+    size_t countRecordedEvents() const noexcept;
+    const InputLatencyStatistics& getLatencyStatistics(
+      InputEventType type
+    ) const noexcept;
+    const VectorR2& getMouseCoordinates() const noexcept;
+    const InputEvent& getRecordedEvent(size_t age) const noexcept;
+    void markFramePresented() noexcept;
+    size_t pollEvents();
+    void subscribe(InputEventType type, InputSubscriber subscriber);
+
+  // Private components.
+  private:
+
+    // Members.
+    std::array<std::vector<InputEvent>, InputEventTypeCount> frame_events;
+    std::array<InputLatencyStatistics, InputEventTypeCount> \
+      latency_statistics = {};
+    std::array<double, InputEventTypeCount> latency_sums = {};
+    VectorR2 mouse_coordinates;
+    std::vector<std::pair<InputEventType, Uint64>> pending_presentations;
+    Uint64 performance_frequency;
+    unsigned long recorded_event_count = 0;
+    std::array<InputEvent, INPUT_MANAGER_RING_BUFFER_SIZE> recorded_events = \
+      {};
+    std::array<std::vector<InputSubscriber>, InputEventTypeCount> subscribers;
+
+    // Method prototypes.
+    bool classifyEvent(
+      const SDL_Event& event,
+      InputEvent& input_event
+    ) noexcept;
+    void dispatchFrameEvents();
+    void recordEvent(const InputEvent& input_event);
+    Uint64 originCounterOf(Uint32 timestamp) const noexcept;
+
+    // Static method prototypes.
+    static bool typeAwaitsPresentation(InputEventType type) noexcept;
+};
+
+#endif // INPUT_MANAGER_H_
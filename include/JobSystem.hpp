@@ -0,0 +1,115 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Job System class - Header file.
+
+// Define guard.
+#ifndef JOB_SYSTEM_H_
+#define JOB_SYSTEM_H_
+
+// Includes.
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Declarations.
+struct JobQueue;
+struct JobRecord;
+class JobSystem;
+
+// Macros.
+#define JOB_SYSTEM_MAX_WORKER_COUNT 8
+
+// Type definitions.
+using JobHandle = std::shared_ptr<JobRecord>;
+using JobFunction = std::function<void()>;
+using ParallelForFunction = std::function<void(size_t begin, size_t end)>;
+
+struct JobRecord {
+  JobFunction function;
+  std::atomic<unsigned int> blocking_dependencies{1};
+  std::atomic<bool> finished{false};
+  std::mutex dependents_mutex;
+  std::vector<JobHandle> dependents;
+  std::exception_ptr error;
+};
+
+struct JobQueue {
+  std::mutex mutex;
+  std::deque<JobHandle> jobs;
+};
+
+// Class definition.
+class JobSystem {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    JobSystem();
+    JobSystem(unsigned int worker_count);
+    ~JobSystem() noexcept;
+
+    // Method prototypes.
+    void enqueueMainThreadJob(JobFunction job);
+    unsigned int getWorkerCount() const noexcept;
+    void parallelFor(
+      size_t count,
+      size_t chunk_size,
+      const ParallelForFunction& body
+    );
+    size_t runMainThreadJobs() noexcept;
+    JobHandle schedule(
+      JobFunction job,
+      const std::vector<JobHandle>& dependencies = {}
+    );
+    void wait(const JobHandle& job);
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    JobSystem(const JobSystem&) = delete;
+
+    // Members.
+    std::thread::id main_thread_id;
+    std::vector<JobFunction> main_thread_jobs;
+    std::mutex main_thread_mutex;
+    std::atomic<size_t> queued_jobs{0};
+    std::vector<std::unique_ptr<JobQueue>> queues;
+    std::mutex sleep_mutex;
+    bool stop_requested = false;
+    std::condition_variable work_condition;
+    std::vector<std::thread> workers;
+
+    // Static members.
+    static thread_local JobSystem* thread_job_system;
+    static thread_local size_t thread_queue_index;
+
+    // Default operator overloadings.
+    JobSystem& operator = (const JobSystem&) = delete;
+
+    // Method prototypes.
+    void finishJob(const JobHandle& job) noexcept;
+    size_t ownQueueIndex() const noexcept;
+    bool popJob(size_t queue_index, JobHandle& job) noexcept;
+    void pushJob(const JobHandle& job);
+    void releaseJob(const JobHandle& job) noexcept;
+    void runJob(const JobHandle& job) noexcept;
+    bool runPendingJob() noexcept;
+    void runWorker(size_t queue_index) noexcept;
+
+    // Static method prototypes.
+    static unsigned int defaultWorkerCount() noexcept;
+};
+
+#endif // JOB_SYSTEM_H_
@@ -0,0 +1,72 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - LZ4 Block class - Header file.
+
+// Define guard.
+#ifndef LZ4_BLOCK_H_
+#define LZ4_BLOCK_H_
+
+// Includes.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+// Declarations.
+class LZ4Block;
+
+// Macros.
+#define LZ4_BLOCK_HASH_BITS 12
+#define LZ4_BLOCK_LAST_LITERALS 5
+#define LZ4_BLOCK_MATCH_SEARCH_LIMIT 12
+#define LZ4_BLOCK_MAX_OFFSET 65535
+#define LZ4_BLOCK_MIN_MATCH 4
+
+// Class definition.
+// Reads and writes the LZ4 block format, so offline tools may use the
+// reference implementation instead.
+class LZ4Block {
+  // Public components.
+  public:
+
+    // Static method prototypes.
+    static int compress(
+      const unsigned char* source,
+      size_t source_size,
+      std::vector<unsigned char>& compressed_block
+    ) noexcept;
+    static int decompress(
+      const unsigned char* compressed_block,
+      size_t compressed_size,
+      unsigned char* destination,
+      size_t destination_size
+    ) noexcept;
+
+  // Private components.
+  private:
+
+    // Static method prototypes.
+    static void appendLength(
+      std::vector<unsigned char>& compressed_block,
+      size_t length
+    );
+    static void appendSequence(
+      std::vector<unsigned char>& compressed_block,
+      const unsigned char* literals,
+      size_t literal_length,
+      size_t match_offset,
+      size_t match_length
+    );
+    static uint32_t hashOf(uint32_t sequence) noexcept;
+    static int readLength(
+      const unsigned char* compressed_block,
+      size_t compressed_size,
+      size_t& position,
+      size_t& length
+    ) noexcept;
+    static uint32_t readSequence(const unsigned char* source) noexcept;
+};
+
+#endif // LZ4_BLOCK_H_
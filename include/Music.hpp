@@ -14,11 +14,16 @@
 // SDL2 includes.
 #include <SDL2/SDL_mixer.h>
 
+// User includes.
+#include "AssetArchive.hpp"
+
 // Template includes.
+#include "templates/AssetHandle.hpp"
 #include "templates/ErrorDescription.hpp"
 #include "templates/RuntimeException.hpp"
 
 // Declarations.
+struct DecodedMusic;
 class Music;
 enum OpenMusicErrorCode : unsigned short;
 class OpenMusicErrorDescription;
@@ -50,7 +55,15 @@ enum StopMusicErrorCode : unsigned short {
 };
 
 // Type definitions.
-using MixMusicUniquePTR = std::unique_ptr<Mix_Music, decltype(&Mix_FreeMusic)>;
+using MixMusicSharedPTR = std::shared_ptr<Mix_Music>;
+
+// The decode time is what opening the track would have cost the main thread.
+struct DecodedMusic {
+  MixMusicSharedPTR music;
+  double decode_time;
+};
+
+using MusicHandle = AssetHandle<DecodedMusic>;
 
 // Auxiliary class definitions.
 class OpenMusicErrorDescription : public ErrorDescription<OpenMusicErrorCode> {
@@ -143,24 +156,30 @@ class Music {
     // Class method prototypes.
     Music() noexcept = default;
     Music(std::string file);
+    Music(const AssetArchive& asset_archive, std::string id);
 
     // Method prototypes.
     bool isOpen() const noexcept;
     bool isUsingMixer() const noexcept;
+    void open(const AssetArchive& asset_archive, std::string id);
+    void open(MixMusicSharedPTR decoded_music);
     void open(std::string file);
-    void play(int times = -1);
+    void play(int times = -1, unsigned int fade_in_duration_milliseconds = 0);
     void stop(unsigned int fade_out_duration_milliseconds = 1500);
 
   // Private components.
   private:
 
     // Members.
-    MixMusicUniquePTR music = MixMusicUniquePTR(nullptr, &Mix_FreeMusic);
+    MixMusicSharedPTR music;
     bool usingMixer = false;
 
     // Method prototypes.
     bool mixerInUse() const noexcept;
-    int useMixerToPlayCurrentMusic(int times) noexcept;
+    int useMixerToPlayCurrentMusic(
+      int times,
+      unsigned int fade_in_duration_milliseconds
+    ) noexcept;
     int useMixerToStopCurrentMusic(
       unsigned int fade_out_duration_milliseconds
     ) noexcept;
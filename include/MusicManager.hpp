@@ -0,0 +1,132 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Music Manager class - Header file.
+
+// Define guard.
+#ifndef MUSIC_MANAGER_H_
+#define MUSIC_MANAGER_H_
+
+// Includes.
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_mixer.h>
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_timer.h>
+
+// User includes.
+#include "AssetLoader.hpp"
+#include "Music.hpp"
+
+// Declarations.
+struct MusicCacheEntry;
+class MusicManager;
+struct MusicPreload;
+struct MusicStatistics;
+
+// Macros.
+#define MUSIC_MANAGER_CACHE_CAPACITY 4
+#define MUSIC_MANAGER_DEFAULT_CROSSFADE_MS 1500
+
+// Type definitions.
+struct MusicCacheEntry {
+  std::string id;
+  MixMusicSharedPTR music;
+};
+
+struct MusicPreload {
+  MusicHandle handle;
+  Uint64 request_counter;
+};
+
+struct MusicStatistics {
+  unsigned long cache_evictions;
+  unsigned long cache_hits;
+  unsigned long cache_misses;
+  unsigned long failed_loads;
+  double last_decode_time;
+  double last_preload_time;
+  double max_decode_time;
+  double max_switch_time;
+  unsigned long track_switches;
+};
+
+// Class definition.
+// Plays one track at a time and switches between them without blocking.
+// Tracks are opened by the asset loader's workers and kept in a small least
+// recently used cache, so returning to a track skips the load. The mixer has
+// a single music stream, so a crossfade is the old track fading out and then
+// the new one fading in, each over half the requested duration. The new track
+// only starts once the stream is free, since starting it earlier would make
+// the mixer wait out the fade on the calling thread. The playing track and the
+// one waiting for it are never evicted, so the cache may briefly overflow.
+class MusicManager {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    MusicManager(
+      AssetLoader& asset_loader,
+      size_t cache_capacity = MUSIC_MANAGER_CACHE_CAPACITY
+    ) noexcept;
+
+    // Method prototypes.
+    const std::string& getCurrentTrack() const noexcept;
+    const MusicStatistics& getStatistics() const noexcept;
+    bool isCached(const std::string& id) const noexcept;
+    bool isSwitching() const noexcept;
+    void play(
+      const std::string& id,
+      unsigned int crossfade_duration_milliseconds = \
+        MUSIC_MANAGER_DEFAULT_CROSSFADE_MS
+    );
+    void preload(const std::string& id);
+    void setCacheCapacity(size_t cache_capacity) noexcept;
+    void stop(
+      unsigned int fade_out_duration_milliseconds = \
+        MUSIC_MANAGER_DEFAULT_CROSSFADE_MS
+    ) noexcept;
+    void update() noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    MusicManager(const MusicManager&) = delete;
+
+    // Members.
+    AssetLoader& asset_loader;
+    // Ordered from the most to the least recently used track.
+    std::vector<MusicCacheEntry> cache;
+    size_t cache_capacity;
+    std::string current_track;
+    unsigned int fade_in_duration_milliseconds = 0;
+    Music music;
+    std::string next_track;
+    std::map<std::string, MusicPreload> preloads;
+    MusicStatistics statistics = {};
+    bool switch_pending = false;
+
+    // Default operator overloadings.
+    MusicManager& operator = (const MusicManager&) = delete;
+
+    // Method prototypes.
+    MixMusicSharedPTR acquireCachedMusic(const std::string& id) noexcept;
+    void cacheMusic(const std::string& id, MixMusicSharedPTR music);
+    void fadeOutCurrentTrack(
+      unsigned int fade_out_duration_milliseconds
+    ) noexcept;
+    void pollPreloads() noexcept;
+    int startNextTrack() noexcept;
+    bool streamIsBusy() const noexcept;
+    void trimCache() noexcept;
+};
+
+#endif // MUSIC_MANAGER_H_
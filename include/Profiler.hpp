@@ -0,0 +1,130 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Profiler class - Header file.
+
+// Define guard.
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+// Includes.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_rect.h>
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_timer.h>
+
+// Declarations.
+struct ProfileRingBuffer;
+struct ProfileSample;
+class ProfileScope;
+class Profiler;
+
+// Macros.
+#define PROFILER_OVERLAY_BAR_WIDTH 3
+#define PROFILER_OVERLAY_FRAME_COUNT 120
+#define PROFILER_OVERLAY_MARGIN 8
+#define PROFILER_OVERLAY_PIXELS_PER_MILLISECOND 4
+#define PROFILER_RING_BUFFER_SIZE 8192
+#define PROFILER_TRACE_FILE "./profile_trace.json"
+
+#define PROFILE_CONCATENATE_TOKENS(first, second) first##second
+#define PROFILE_SCOPE_VARIABLE(line) \
+  PROFILE_CONCATENATE_TOKENS(profile_scope_, line)
+
+// Scoped timers and frame marks vanish unless built with -DENABLE_PROFILING.
+#ifdef ENABLE_PROFILING
+#define PROFILE_FRAME() Profiler::markFrameBoundary()
+#define PROFILE_SCOPE(scope_name) \
+  ProfileScope PROFILE_SCOPE_VARIABLE(__LINE__)(scope_name)
+#else
+#define PROFILE_FRAME()
+#define PROFILE_SCOPE(scope_name)
+#endif
+
+// Type definitions.
+struct ProfileSample {
+  const char* name;
+  Uint64 start_counter;
+  Uint64 end_counter;
+};
+
+struct ProfileRingBuffer {
+  std::array<ProfileSample, PROFILER_RING_BUFFER_SIZE> samples;
+  std::atomic<unsigned long> recorded_samples;
+  unsigned long thread_index;
+};
+
+// Auxiliary class definitions.
+class ProfileScope {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    ProfileScope(const char* scope_name) noexcept;
+    ~ProfileScope() noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    ProfileScope(const ProfileScope&) = delete;
+
+    // Members.
+    const char* scope_name;
+    Uint64 start_counter;
+
+    // Default operator overloadings.
+    ProfileScope& operator = (const ProfileScope&) = delete;
+};
+
+// Class definition.
+class Profiler {
+  // Public components.
+  public:
+
+    // Static method prototypes.
+    static int exportChromeTrace(
+      const std::string& trace_file = PROFILER_TRACE_FILE
+    ) noexcept;
+    static void markFrameBoundary() noexcept;
+    static void recordSample(const ProfileSample& sample) noexcept;
+    static void renderOverlay(SDL_Renderer* renderer) noexcept;
+    static void setFrameBudget(double frame_budget) noexcept;
+
+  // Private components.
+  private:
+
+    // Static members.
+    static Uint64 epoch_counter;
+    static double frame_budget;
+    static std::array<double, PROFILER_OVERLAY_FRAME_COUNT> frame_durations;
+    static Uint64 last_frame_counter;
+    static unsigned long recorded_frames;
+    static std::vector<std::shared_ptr<ProfileRingBuffer>> ring_buffers;
+    static std::mutex ring_buffers_mutex;
+
+    // Static method prototypes.
+    static double microsecondsSinceEpoch(Uint64 counter) noexcept;
+    static ProfileRingBuffer& threadRingBuffer();
+    static void writeTraceEvent(
+      std::ofstream& trace_stream,
+      const ProfileSample& sample,
+      unsigned long thread_index
+    );
+};
+
+#endif // PROFILER_H_
@@ -0,0 +1,90 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Raw Texture class - Header file.
+
+// Define guard.
+#ifndef RAW_TEXTURE_H_
+#define RAW_TEXTURE_H_
+
+// Includes.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_pixels.h>
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_surface.h>
+
+// User includes.
+#include "LZ4Block.hpp"
+
+// Declarations.
+class RawTexture;
+enum RawTextureCompression : uint32_t;
+struct RawTextureHeader;
+
+// Macros.
+#define RAW_TEXTURE_MAGIC "AATEX001"
+#define RAW_TEXTURE_MAGIC_SIZE 8
+#define RAW_TEXTURE_PIXEL_FORMAT SDL_PIXELFORMAT_ARGB8888
+#define RAW_TEXTURE_VERSION 1
+
+// Enumeration definitions.
+enum RawTextureCompression : uint32_t {
+  RawTextureUncompressed,
+  RawTextureLZ4
+};
+
+// Type definitions.
+// The header keeps the pixels after it 16-byte aligned.
+struct RawTextureHeader {
+  char magic[RAW_TEXTURE_MAGIC_SIZE];
+  uint32_t version;
+  uint32_t pixel_format;
+  uint32_t width;
+  uint32_t height;
+  uint32_t pitch;
+  uint32_t compression;
+  uint64_t pixel_data_size;
+  uint64_t payload_size;
+};
+
+// Class definition.
+// Pixels stored in the renderer's native format, so loading one is a copy
+// into a texture instead of a PNG or JPEG decode.
+class RawTexture {
+  // Public components.
+  public:
+
+    // Static method prototypes.
+    static int encode(
+      SDL_Surface* surface,
+      RawTextureCompression compression,
+      std::vector<unsigned char>& raw_texture
+    ) noexcept;
+    static int encodeImageFile(
+      const std::string& image_file,
+      RawTextureCompression compression,
+      std::vector<unsigned char>& raw_texture
+    ) noexcept;
+    static bool isRawTexture(const void* data, size_t size) noexcept;
+    static SDL_Surface* loadSurface(const void* data, size_t size) noexcept;
+
+  // Private components.
+  private:
+
+    // Static method prototypes.
+    static int readHeader(
+      const void* data,
+      size_t size,
+      RawTextureHeader& header
+    ) noexcept;
+};
+
+#endif // RAW_TEXTURE_H_
@@ -8,7 +8,10 @@
 #define SOUND_H_
 
 // Includes.
+#include <exception>
+#include <iostream>
 #include <string>
+#include <vector>
 
 // SDL2 includes.
 #include <SDL2/SDL_mixer.h>
@@ -16,9 +19,12 @@
 
 // User includes.
 #include "GameObject.hpp"
+#include "SoundChunkCache.hpp"
+#include "VoiceManager.hpp"
 
 // Template includes.
 #include "templates/ErrorDescription.hpp"
+#include "templates/PoolAllocated.hpp"
 #include "templates/RuntimeException.hpp"
 
 // Declarations.
@@ -134,20 +140,51 @@ class StopSoundException :
 };
 
 // Class definition.
-class Sound : public Component {
+class Sound : public Component, public PoolAllocated<Sound> {
   // Public components.
   public:
 
+    // Static members.
+    static constexpr bool has_render_work = false;
+    static constexpr bool has_update_work = false;
+    static constexpr ComponentType component_type = \
+      ComponentType::SoundComponent;
+    // Playback goes through the shared voice manager, so updates are serial.
+    static constexpr bool updates_shared_state = true;
+
     // Class method prototypes.
     Sound(GameObject& associated);
     Sound(GameObject& associated, std::string file);
+    Sound(
+      GameObject& associated,
+      SoundChunkCache& sound_chunk_cache,
+      std::string file
+    );
+    Sound(
+      GameObject& associated,
+      SoundChunkCache& sound_chunk_cache,
+      VoiceManager& voice_manager,
+      std::string file,
+      int priority = VOICE_MANAGER_DEFAULT_PRIORITY,
+      int volume = VOICE_MANAGER_DEFAULT_VOLUME
+    );
+    Sound(
+      GameObject& associated,
+      const SoundChunkHandle& sound_chunk_handle,
+      VoiceManager& voice_manager,
+      int priority = VOICE_MANAGER_DEFAULT_PRIORITY,
+      int volume = VOICE_MANAGER_DEFAULT_VOLUME
+    );
     ~Sound() noexcept;
 
     // Method prototypes.
     bool finishedPlaying() const noexcept;
+    bool finishWillBeReported() const noexcept;
     bool hasReservedChannel() const noexcept;
     bool isOpen() const noexcept;
+    void open(const SoundChunkHandle& sound_chunk_handle);
     void open(std::string file);
+    void open(SoundChunkCache& sound_chunk_cache, std::string file);
     void play(int loops_after_first_time_played = 0);
     void render(SDL_Renderer* renderer) noexcept override;
     void stop();
@@ -161,7 +198,17 @@ class Sound : public Component {
 
     // Members.
     int channel = -1;
-    Mix_Chunk* sound = nullptr;
+    SoundChunkHandle pending_chunk;
+    int priority = VOICE_MANAGER_DEFAULT_PRIORITY;
+    MixChunkSharedPTR sound;
+    bool voice_dropped = false;
+    unsigned long voice_generation = 0;
+    VoiceManager* voice_manager = nullptr;
+    int volume = VOICE_MANAGER_DEFAULT_VOLUME;
+
+    // Static members.
+    // Bumped on every mixer play, so sounds sharing a chunk stay distinct.
+    static std::vector<unsigned long> channel_generations;
 
     // Default operator overloadings.
     Sound& operator = (const Sound&) = delete;
@@ -169,13 +216,22 @@ class Sound : public Component {
     // Method prototypes.
     void cleanUpCurrentSound() noexcept;
     int loadSoundFile(std::string file) noexcept;
+    int loadSoundFileFromCache(
+      SoundChunkCache& sound_chunk_cache,
+      std::string file
+    ) noexcept;
+    void openPendingChunk() noexcept;
     int playCurrentSoundWithMixer(int loops_after_first_time_played) noexcept;
+    int playCurrentSoundWithVoiceManager(
+      int loops_after_first_time_played
+    ) noexcept;
     bool reservedChannelHasNotBeenReassigned() const noexcept;
     bool reservedChannelIsInUse() const noexcept;
     bool soundIsPlaying() const noexcept;
     bool soundStartedPlaying() const noexcept;
     void stopSoundCurrentlyPlaying() noexcept;
     void stopSoundOnReservedChannel() noexcept;
+    bool voiceIsCurrent() const noexcept;
 };
 
 #endif // SOUND_H_
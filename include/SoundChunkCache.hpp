@@ -0,0 +1,85 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Sound Chunk Cache class - Header file.
+
+// Define guard.
+#ifndef SOUND_CHUNK_CACHE_H_
+#define SOUND_CHUNK_CACHE_H_
+
+// Includes.
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_mixer.h>
+
+// User includes.
+#include "AssetArchive.hpp"
+
+// Template includes.
+#include "templates/AssetHandle.hpp"
+
+// Declarations.
+class SoundChunkCache;
+
+// Type definitions.
+using MixChunkSharedPTR = std::shared_ptr<Mix_Chunk>;
+using SoundChunkHandle = AssetHandle<MixChunkSharedPTR>;
+
+// Class definition.
+class SoundChunkCache {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    SoundChunkCache() noexcept = default;
+    ~SoundChunkCache() noexcept;
+
+    // Method prototypes.
+    MixChunkSharedPTR acquire(const std::string& file) noexcept;
+    MixChunkSharedPTR acquire(
+      const std::string& file,
+      Mix_Chunk* decoded_chunk
+    ) noexcept;
+    void clear() noexcept;
+    bool contains(const std::string& file) const noexcept;
+    size_t freeRetiredChunks() noexcept;
+    unsigned long getHitCount() const noexcept;
+    unsigned long getMissCount() const noexcept;
+    size_t releaseUnusedChunks() noexcept;
+    void setAssetArchive(const AssetArchive* asset_archive) noexcept;
+    size_t size() const noexcept;
+
+    // Static method prototypes.
+    static bool chunkIsPlaying(const Mix_Chunk* chunk) noexcept;
+    static MixChunkSharedPTR loadChunk(const std::string& file) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    SoundChunkCache(const SoundChunkCache&) = delete;
+
+    // Members.
+    const AssetArchive* asset_archive = nullptr;
+    std::map<std::string, MixChunkSharedPTR> chunks;
+    unsigned long hit_count = 0;
+    unsigned long miss_count = 0;
+    std::vector<MixChunkSharedPTR> retired_chunks;
+
+    // Default operator overloadings.
+    SoundChunkCache& operator = (const SoundChunkCache&) = delete;
+
+    // Method prototypes.
+    MixChunkSharedPTR loadCachedChunk(const std::string& file) const noexcept;
+
+    // Static method prototypes.
+    static void freeChunkHaltingChannels(Mix_Chunk* chunk) noexcept;
+};
+
+#endif // SOUND_CHUNK_CACHE_H_
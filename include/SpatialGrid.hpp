@@ -0,0 +1,99 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Spatial Grid class - Header file.
+
+// Define guard.
+#ifndef SPATIAL_GRID_H_
+#define SPATIAL_GRID_H_
+
+// Includes.
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// User includes.
+#include "Rectangle.hpp"
+#include "VectorR2.hpp"
+
+// Declarations.
+class GameObject;
+struct GridCellRange;
+class SpatialGrid;
+
+// Macros.
+#define SPATIAL_GRID_CELL_SIZE 128
+
+// Type definitions.
+struct GridCellRange {
+  long first_column;
+  long first_row;
+  long last_column;
+  long last_row;
+};
+
+// Class definition.
+class SpatialGrid {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    SpatialGrid(double cell_size = SPATIAL_GRID_CELL_SIZE) noexcept;
+
+    // Method prototypes.
+    double getMaxStepMotion() const noexcept;
+    void insert(GameObject* game_object);
+    GameObject* livingGameObjectWithLeastDepthLocatedAt(
+      const VectorR2& search_coordinates
+    ) const noexcept;
+    void queryRectangle(
+      const Rectangle& search_area,
+      std::vector<GameObject*>& search_results
+    ) const;
+    void queryRectangleUnordered(
+      const Rectangle& search_area,
+      std::vector<GameObject*>& search_results
+    ) const;
+    void remove(GameObject* game_object) noexcept;
+    void resetStepMotion() noexcept;
+    size_t size() const noexcept;
+    void update(GameObject* game_object);
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    SpatialGrid(const SpatialGrid&) = delete;
+
+    // Members.
+    double cell_size;
+    std::unordered_map<long long, std::vector<GameObject*>> cells;
+    std::unordered_map<GameObject*, GridCellRange> indexed_ranges;
+    // How far any swept box reaches past its current box during this step.
+    double max_step_motion = 0;
+
+    // Default operator overloadings.
+    SpatialGrid& operator = (const SpatialGrid&) = delete;
+
+    // Method prototypes.
+    void addToCells(GameObject* game_object, const GridCellRange& cell_range);
+    long long cellKey(long column, long row) const noexcept;
+    GridCellRange cellRangeCoveredBy(const Rectangle& area) const noexcept;
+    long cellIndexOf(double coordinate) const noexcept;
+    long long cellKeyOf(const VectorR2& coordinates) const noexcept;
+    void recordStepMotion(const GameObject* game_object) noexcept;
+    void removeFromCells(
+      GameObject* game_object,
+      const GridCellRange& cell_range
+    ) noexcept;
+
+    // Static method prototypes.
+    static GameObject* livingGameObjectWithLeastDepthIn(
+      const std::vector<GameObject*>& cell_contents,
+      const VectorR2& search_coordinates
+    ) noexcept;
+};
+
+#endif // SPATIAL_GRID_H_
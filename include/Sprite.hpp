@@ -8,6 +8,8 @@
 #define SPRITE_H_
 
 // Includes.
+#include <exception>
+#include <iostream>
 #include <memory>
 #include <string>
 
@@ -19,9 +21,12 @@
 
 // User includes.
 #include "GameObject.hpp"
+#include "SpriteBatch.hpp"
+#include "TextureCache.hpp"
 
 // Template includes.
 #include "templates/ErrorDescription.hpp"
+#include "templates/PoolAllocated.hpp"
 #include "templates/RuntimeException.hpp"
 
 // Declarations.
@@ -36,10 +41,6 @@ enum OpenSpriteErrorCode : unsigned short {
   ConfigureSpriteError
 };
 
-// Type definitions.
-using SDLTextureUniquePTR = \
-  std::unique_ptr<SDL_Texture, decltype(&SDL_DestroyTexture)>;
-
 // Auxiliary class definitions.
 class OpenSpriteErrorDescription :
   public ErrorDescription<OpenSpriteErrorCode>
@@ -72,19 +73,42 @@ class OpenSpriteException :
 };
 
 // Class definition.
-class Sprite : public Component {
+class Sprite : public Component, public PoolAllocated<Sprite> {
   // Public components.
   public:
 
+    // Static members.
+    static constexpr bool has_render_work = true;
+    static constexpr bool has_update_work = false;
+    static constexpr ComponentType component_type = \
+      ComponentType::SpriteComponent;
+    static constexpr bool updates_shared_state = false;
+
     // Class method prototypes.
     Sprite(GameObject& associated);
+    Sprite(GameObject& associated, const TextureHandle& texture_handle);
     Sprite(GameObject& associated, SDL_Renderer* renderer, std::string file);
+    Sprite(
+      GameObject& associated,
+      TextureCache& texture_cache,
+      SDL_Renderer* renderer,
+      std::string file
+    );
 
     // Method prototypes.
+    void appendToBatch(SpriteBatch& sprite_batch) const;
     int getHeight() const noexcept;
     int getWidth() const noexcept;
+    bool hasPendingTexture() const noexcept;
     bool isOpen() const noexcept;
+    void open(const TextureHandle& texture_handle);
     void open(SDL_Renderer* renderer, std::string file);
+    void open(
+      TextureCache& texture_cache,
+      SDL_Renderer* renderer,
+      std::string file
+    );
+    void openPendingTexture() noexcept;
     void render(SDL_Renderer* renderer) noexcept override;
     void setClip(int x_pos, int y_pos, int width, int height) noexcept;
     void update(double dt) noexcept override;
@@ -95,15 +119,22 @@ class Sprite : public Component {
     // Members.
     SDL_Rect clip_rect;
     int height = 0;
-    SDLTextureUniquePTR texture = SDLTextureUniquePTR(
-      nullptr,
-      &SDL_DestroyTexture
-    );
+    TextureHandle pending_texture;
+    SDLTextureSharedPTR texture;
+    SDL_Rect texture_region = {.x = 0, .y = 0, .w = 0, .h = 0};
     int width = 0;
 
     // Method prototypes.
     int configSpriteWithTextureSpecs() noexcept;
+    void configureOpenedTexture();
+    SDL_Rect sourceRectInTexture() const noexcept;
+    void useTextureRegion(const TextureRegion& texture_region) noexcept;
     int loadSpriteTexture(SDL_Renderer* renderer, std::string file) noexcept;
+    int loadSpriteTextureFromCache(
+      TextureCache& texture_cache,
+      SDL_Renderer* renderer,
+      std::string file
+    ) noexcept;
 };
 
 #endif // SPRITE_H_
@@ -0,0 +1,60 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Sprite Batch class - Header file.
+
+// Define guard.
+#ifndef SPRITE_BATCH_H_
+#define SPRITE_BATCH_H_
+
+// Includes.
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_rect.h>
+#include <SDL2/SDL_render.h>
+
+// Declarations.
+class SpriteBatch;
+
+// Macros.
+#define SPRITE_BATCH_INITIAL_CAPACITY 256
+
+// Class definition.
+class SpriteBatch {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    SpriteBatch();
+
+    // Method prototypes.
+    void addSprite(
+      SDL_Texture* texture,
+      const SDL_Rect& source_rect,
+      const SDL_FRect& destination_rect
+    );
+    void begin(SDL_Renderer* renderer) noexcept;
+    void end() noexcept;
+    void flush() noexcept;
+    unsigned long getDrawCallCount() const noexcept;
+    unsigned long getSpriteCount() const noexcept;
+
+  // Private components.
+  private:
+
+    // Members.
+    SDL_Texture* batch_texture = nullptr;
+    int batch_texture_height = 1;
+    int batch_texture_width = 1;
+    unsigned long draw_call_count = 0;
+    std::vector<int> indices;
+    SDL_Renderer* renderer = nullptr;
+    unsigned long sprite_count = 0;
+    std::vector<SDL_Vertex> vertices;
+
+    // Method prototypes.
+    void switchToTexture(SDL_Texture* texture) noexcept;
+};
+
+#endif // SPRITE_BATCH_H_
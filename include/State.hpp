@@ -14,108 +14,214 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 // SDL2 includes.
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_events.h>
 #include <SDL2/SDL_keyboard.h>
-#include <SDL2/SDL_mouse.h>
-#include <SDL2/SDL_quit.h>
 #include <SDL2/SDL_stdinc.h>
 
 // User includes.
+#include "AssetArchive.hpp"
+#include "AssetLoader.hpp"
+#include "AssetManifest.hpp"
+#include "Collider.hpp"
+#include "CollisionSystem.hpp"
+#include "CommandBuffer.hpp"
+#include "ComponentRegistry.hpp"
 #include "Face.hpp"
 #include "GameObject.hpp"
-#include "Music.hpp"
+#include "InputManager.hpp"
+#include "JobSystem.hpp"
+#include "MusicManager.hpp"
+#include "Profiler.hpp"
 #include "Sound.hpp"
+#include "SoundChunkCache.hpp"
+#include "SpatialGrid.hpp"
 #include "Sprite.hpp"
+#include "SpriteBatch.hpp"
+#include "TextureCache.hpp"
+#include "VectorBatch.hpp"
 #include "VectorR2.hpp"
+#include "VoiceManager.hpp"
 
 // Declarations.
+enum ComponentStorageMode : unsigned short;
 class State;
 
 // Macros.
-#define BACKGROUND_SPRITE_FILE "./assets/img/ocean.jpg"
-#define ENEMY_SOUND_FILE "./assets/audio/boom.wav"
-#define ENEMY_SPRITE_FILE "./assets/img/penguinface.png"
-#define STATE_MUSIC_FILE "./assets/audio/stage_state.ogg"
+#define BACKGROUND_SPRITE_ID "background"
+#define CULLING_SPATIAL_INDEX_THRESHOLD 256
+#define ENEMY_SOUND_ID "enemy_death"
+#define ENEMY_SPRITE_ID "enemy"
+#define LOADING_BAR_HEIGHT 6
+#define STATE_ASSET_ARCHIVE_FILE "./assets/assets.pak"
+#define STATE_ASSET_MANIFEST_FILE "./assets/manifest.txt"
+#define STATE_MUSIC_ID "stage_music"
+#define STATE_UPDATE_CHUNK_SIZE 256
+
+// Enumeration definitions.
+enum ComponentStorageMode : unsigned short {
+  ObjectStorageMode,
+  RegistryStorageMode
+};
 
 // Type definitions.
+struct RenderStatistics {
+  unsigned long draw_calls;
+  unsigned long sprites_drawn;
+  unsigned long objects_drawn;
+  unsigned long objects_culled;
+};
+
 struct BackgroundParams {
-  std::string sprite_file;
+  std::string sprite_id;
 };
 
 struct EnemyParams {
-  std::string sprite_file;
-  std::string sound_file;
+  std::string sprite_id;
+  std::string sound_id;
   VectorR2 coordinates;
 };
 
+// Sizing grows the box from its corner, so centered objects move back after.
+struct PendingSpriteObject {
+  GameObject* game_object;
+  bool keeps_center;
+};
+
 // Class definition.
 class State {
   // Public components.
   public:
 
     // Class method prototypes.
-    State(SDL_Renderer* renderer);
+    State(SDL_Renderer* renderer, JobSystem& job_system);
 
     // Method prototypes.
+    void clickAt(const VectorR2& click_coordinates);
+    size_t countGameObjects() const noexcept;
+    size_t countPendingCommands() const noexcept;
+    double getAssetLoadTime() const noexcept;
+    const CollisionStatistics& getCollisionStatistics() const noexcept;
+    ComponentStorageMode getComponentStorageMode() const noexcept;
+    const InputLatencyStatistics& getInputLatencyStatistics(
+      InputEventType type
+    ) const noexcept;
+    double getLoadingProgress() const noexcept;
+    const MusicStatistics& getMusicStatistics() const noexcept;
+    const RenderStatistics& getRenderStatistics() const noexcept;
+    const SoundChunkCache& getSoundChunkCache() const noexcept;
+    const TextureCache& getTextureCache() const noexcept;
+    const VoiceStatistics& getVoiceStatistics() const noexcept;
     void loadAssets();
+    void playMusic(
+      const std::string& id,
+      unsigned int crossfade_duration_milliseconds = \
+        MUSIC_MANAGER_DEFAULT_CROSSFADE_MS
+    );
     void processInput();
     bool quitRequested() const noexcept;
-    void renderAndPresent();
+    void renderAndPresent(double interpolation_factor = 1);
+    void setComponentStorageMode(ComponentStorageMode storage_mode) noexcept;
+    void setMusicCacheCapacity(size_t cache_capacity) noexcept;
+    void setPreserveDepthOrder(bool preserve_depth_order) noexcept;
+    void spawnEnemyAt(const VectorR2& spawn_coordinates);
     void update(double dt);
 
   // Private components.
   private:
 
     // Members.
-    Music music;
+    // The manifest comes first, since the archive falls back to its paths.
+    AssetManifest asset_manifest;
+    AssetArchive asset_archive;
+    // Declared before the asset loader, so they outlive its references.
+    SoundChunkCache sound_chunk_cache;
+    TextureCache texture_cache;
+    Uint64 asset_load_start_counter = 0;
+    double asset_load_time = 0;
+    AssetLoader asset_loader;
+    bool assets_loaded = false;
+    CollisionSystem collision_system;
+    CommandBuffer command_buffer;
+    ComponentRegistry component_registry;
+    ComponentStorageMode component_storage_mode = RegistryStorageMode;
+    // Deaths with no voice to report back on, requested after the flush.
+    std::vector<GameObject*> finished_dying_game_objects;
+    std::vector<GameObject*> finished_voice_owners;
+    InputManager input_manager;
+    JobSystem& job_system;
+    MusicManager music_manager;
+    // Declared before the object array, so it outlives the sounds using it.
+    VoiceManager voice_manager;
+    SpatialGrid spatial_index;
+    unsigned long next_spawn_order = 0;
     std::vector<std::unique_ptr<GameObject>> objectArray;
+    // Polled once per frame, instead of every sprite polling its own handle.
+    std::vector<PendingSpriteObject> pending_sprite_objects;
+    // Cleared, removals move the last object forward, so it draws lower.
+    bool preserve_depth_order = true;
+    bool profiler_overlay_visible = false;
     bool quit_requested = false;
+    RenderStatistics render_statistics = {};
     SDL_Renderer* renderer;
+    SpriteBatch sprite_batch;
+    std::vector<unsigned char> visibility_flags;
+    std::vector<float> visibility_test_boxes;
+    unsigned long visibility_frame = 0;
+    std::vector<GameObject*> visible_game_objects;
 
     // Method prototypes.
     void addBackgroundGameObject(const BackgroundParams& background_params);
     void addEnemyGameObject(const EnemyParams& enemy_params);
     void addGameObject(GameObject* new_game_object);
-    int applyDamageToGameObject(
-      std::unique_ptr<GameObject>& damage_target,
-      unsigned int damage
-    );
-    game_object_iter convertReverseIterToIter(
-      game_object_reverse_iter reverse_iterator
-    ) const;
-    bool gameObjectFinishedPlayingDeathSound(
+    int applyDamageToGameObject(GameObject& damage_target, unsigned int damage);
+    void flushCommandBuffer();
+    bool forgetGameObjectIfDeletionWasRequested(
       std::unique_ptr<GameObject>& game_object
-    ) const noexcept;
-    bool gameObjectIsAptForDeletion(
-      std::unique_ptr<GameObject>& game_object
-    ) const noexcept;
-    void handleClickOnGameObject(game_object_iter target_iter);
-    void handleEvent(
-      const SDL_Event& event,
-      const VectorR2& mouse_coordinates
-    );
+    ) noexcept;
+    bool gameObjectWaitsOnDeathSound(GameObject& game_object) const noexcept;
+    void handleClickOnGameObject(GameObject* target);
     void handleKeyDown(
       const SDL_Keysym& keysym,
       const VectorR2& mouse_coordinates
     );
-    void handleMouseButtonDown(const VectorR2& mouse_coordinates);
-    game_object_iter livingGameObjectWithLeastDepthLocatedAt(
+    void handleKeyDownEvents(const std::vector<InputEvent>& events);
+    void handleMouseButtonDownEvents(const std::vector<InputEvent>& events);
+    void handleQuitEvents(const std::vector<InputEvent>& events) noexcept;
+    GameObject* livingGameObjectWithLeastDepthLocatedAt(
       const VectorR2& search_coordinates
+    ) const noexcept;
+    unsigned long markGameObjectsInsideViewport(const Rectangle& viewport);
+    unsigned long markGameObjectsInsideViewportWithAABBTest(
+      const Rectangle& viewport
+    );
+    unsigned long markGameObjectsInsideViewportWithSpatialIndex(
+      const Rectangle& viewport
     );
-    VectorR2 mouseCoordinates() const noexcept;
-    void playMusic() noexcept;
+    void openAssetArchive() noexcept;
+    void openPendingSprites() noexcept;
+    void pollAssetLoading() noexcept;
     VectorR2 randomCoordinatesWithMagnitude(
       unsigned int coordinates_magnitude
     ) const noexcept;
-    void removeGameObjectAt(size_t index);
-    void removeGameObjectsWhoseDeletionWasRequested();
-    void renderGameObjects();
-    void requestDeletionOfGameObjectsAptForDeletion() noexcept;
-    void stopMusic() noexcept;
+    void removeGameObjectsAptForDeletion();
+    void removeGameObjectsAptForDeletionPreservingOrder();
+    void removeGameObjectsAptForDeletionWithSwapAndPop();
+    void renderGameObjects(double interpolation_factor);
+    void renderGameObjectsByObject(double interpolation_factor);
+    void renderGameObjectsByRegistry(double interpolation_factor);
+    void renderLoadingBar() noexcept;
+    void requestDeletionOfGameObjectsDoneDying() noexcept;
+    void resolveCollisions();
+    void subscribeToInput();
+    Rectangle viewportRectangle() const noexcept;
     void updateGameObjects(double dt);
+    void updateGameObjectsByObject(double dt);
+    void updateGameObjectsByRegistry(double dt);
+    void updateGameObjectsInParallel(double dt);
+    void watchPendingSprite(GameObject* game_object, bool keeps_center = false);
 };
 
 #endif // STATE_H_
@@ -0,0 +1,65 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Texture Atlas class - Header file.
+
+// Define guard.
+#ifndef TEXTURE_ATLAS_H_
+#define TEXTURE_ATLAS_H_
+
+// Includes.
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_pixels.h>
+#include <SDL2/SDL_rect.h>
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_surface.h>
+
+// Declarations.
+class TextureAtlas;
+
+// Macros.
+#define TEXTURE_ATLAS_CLEAR_BAND_ROWS 64
+#define TEXTURE_ATLAS_PADDING 1
+#define TEXTURE_ATLAS_PIXEL_FORMAT SDL_PIXELFORMAT_ARGB8888
+#define TEXTURE_ATLAS_SIZE 2048
+
+// Class definition.
+class TextureAtlas {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    TextureAtlas(SDL_Renderer* renderer);
+
+    // Method prototypes.
+    std::shared_ptr<SDL_Texture> getTexture() const noexcept;
+    bool isValid() const noexcept;
+    int pack(SDL_Surface* surface, SDL_Rect& packed_region) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    TextureAtlas(const TextureAtlas&) = delete;
+
+    // Members.
+    int shelf_height = 0;
+    int shelf_x = 0;
+    int shelf_y = 0;
+    std::shared_ptr<SDL_Texture> texture;
+
+    // Default operator overloadings.
+    TextureAtlas& operator = (const TextureAtlas&) = delete;
+
+    // Method prototypes.
+    int clearToTransparent() noexcept;
+    int reserveRegion(int width, int height, SDL_Rect& region) noexcept;
+    int uploadSurface(SDL_Surface* surface, const SDL_Rect& region) noexcept;
+};
+
+#endif // TEXTURE_ATLAS_H_
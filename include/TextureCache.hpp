@@ -0,0 +1,140 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Texture Cache class - Header file.
+
+// Define guard.
+#ifndef TEXTURE_CACHE_H_
+#define TEXTURE_CACHE_H_
+
+// Includes.
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_rect.h>
+#include <SDL2/SDL_render.h>
+#include <SDL2/SDL_surface.h>
+
+// User includes.
+#include "AssetArchive.hpp"
+#include "RawTexture.hpp"
+#include "TextureAtlas.hpp"
+
+// Template includes.
+#include "templates/AssetHandle.hpp"
+
+// Declarations.
+class TextureCache;
+struct TextureRegion;
+
+// Macros.
+#define TEXTURE_ATLAS_MAX_PACKED_SIZE 256
+
+// Type definitions.
+using SDLTextureSharedPTR = std::shared_ptr<SDL_Texture>;
+using TextureCacheKey = std::pair<SDL_Renderer*, std::string>;
+
+struct TextureRegion {
+  SDLTextureSharedPTR texture;
+  SDL_Rect region;
+};
+
+using TextureHandle = AssetHandle<TextureRegion>;
+
+// Class definition.
+class TextureCache {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    TextureCache() noexcept = default;
+
+    // Method prototypes.
+    TextureRegion acquire(
+      SDL_Renderer* renderer,
+      const std::string& file
+    ) noexcept;
+    TextureRegion acquire(
+      SDL_Renderer* renderer,
+      const std::string& file,
+      SDL_Surface* decoded_surface
+    ) noexcept;
+    void clear() noexcept;
+    bool contains(
+      SDL_Renderer* renderer,
+      const std::string& file
+    ) const noexcept;
+    size_t getAtlasCount() const noexcept;
+    unsigned long getHitCount() const noexcept;
+    unsigned long getMissCount() const noexcept;
+    size_t releaseUnusedTextures() noexcept;
+    void setAssetArchive(const AssetArchive* asset_archive) noexcept;
+    void setAtlasPacking(bool atlas_packing) noexcept;
+    size_t size() const noexcept;
+
+    // Static method prototypes.
+    static SDL_Surface* loadSurface(
+      const AssetArchive& asset_archive,
+      const std::string& id
+    ) noexcept;
+    static TextureRegion loadTexture(
+      SDL_Renderer* renderer,
+      const std::string& file
+    ) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    TextureCache(const TextureCache&) = delete;
+
+    // Members.
+    const AssetArchive* asset_archive = nullptr;
+    bool atlas_packing = true;
+    std::map<
+      SDL_Renderer*,
+      std::vector<std::unique_ptr<TextureAtlas>>
+    > atlases;
+    unsigned long hit_count = 0;
+    unsigned long miss_count = 0;
+    std::map<TextureCacheKey, TextureRegion> textures;
+
+    // Default operator overloadings.
+    TextureCache& operator = (const TextureCache&) = delete;
+
+    // Method prototypes.
+    SDL_Surface* decodeSurface(const std::string& file) const noexcept;
+    TextureRegion loadPackableTexture(
+      SDL_Renderer* renderer,
+      const std::string& file
+    ) noexcept;
+    TextureRegion loadWholeTexture(
+      SDL_Renderer* renderer,
+      const std::string& file
+    ) const noexcept;
+    TextureRegion packIntoAtlas(
+      SDL_Renderer* renderer,
+      SDL_Surface* surface
+    ) noexcept;
+    TextureRegion textureFromSurface(
+      SDL_Renderer* renderer,
+      SDL_Surface* surface
+    ) noexcept;
+
+    // Static method prototypes.
+    static SDL_Texture* createTexture(
+      SDL_Renderer* renderer,
+      SDL_Surface* surface
+    ) noexcept;
+    static bool fitsInAtlas(const SDL_Surface* surface) noexcept;
+    static TextureRegion wholeTextureRegion(SDL_Texture* texture) noexcept;
+};
+
+#endif // TEXTURE_CACHE_H_
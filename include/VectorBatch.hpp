@@ -0,0 +1,166 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Vector Batch class - Header file.
+
+// Define guard.
+#ifndef VECTOR_BATCH_H_
+#define VECTOR_BATCH_H_
+
+// Includes.
+#include <cmath>
+#include <cstddef>
+
+// User includes.
+#include "Rectangle.hpp"
+#include "VectorR2.hpp"
+
+// Macros.
+// SIMD paths exist on x86 only; other targets always take the scalar path.
+#if defined(__GNUC__) && defined(__SSE2__) && \
+  (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_BATCH_X86
+#define VECTOR_BATCH_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+// Intrinsic includes.
+#ifdef VECTOR_BATCH_X86
+#include <immintrin.h>
+#endif
+
+// Declarations.
+class VectorBatch;
+enum VectorBatchPath : unsigned short;
+
+// Enumeration definitions.
+enum VectorBatchPath : unsigned short {
+  ScalarPath,
+  SSE2Path,
+  AVX2Path
+};
+
+// Class definition.
+// Kernels over positions stored as separate x and y float arrays. The widest
+// path the CPU supports is picked once; every path gives the same results as
+// the matching VectorR2f and Rectanglef methods.
+class VectorBatch {
+  // Public components.
+  public:
+
+    // Static method prototypes.
+    static VectorBatchPath getPath() noexcept;
+    static size_t markInsideRectangle(
+      const float* xs,
+      const float* ys,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags
+    ) noexcept;
+    static size_t markIntersectingRectangle(
+      const float* lefts,
+      const float* tops,
+      const float* rights,
+      const float* bottoms,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags
+    ) noexcept;
+    static void rotateClockwise(
+      float* xs,
+      float* ys,
+      size_t count,
+      float rotation_angle_in_radians
+    ) noexcept;
+    static int setPath(VectorBatchPath path) noexcept;
+    static bool supportsPath(VectorBatchPath path) noexcept;
+    static void transform(
+      float* xs,
+      float* ys,
+      size_t count,
+      float scale,
+      const VectorR2f& offset
+    ) noexcept;
+
+  // Private components.
+  private:
+
+    // Static members.
+    static VectorBatchPath path;
+
+    // Static method prototypes.
+    static VectorBatchPath detectPath() noexcept;
+
+#ifdef VECTOR_BATCH_X86
+    static size_t markInsideRectangleAVX2(
+      const float* xs,
+      const float* ys,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags,
+      size_t& inside_count
+    ) noexcept;
+    static size_t markInsideRectangleSSE2(
+      const float* xs,
+      const float* ys,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags,
+      size_t& inside_count
+    ) noexcept;
+    static size_t markIntersectingRectangleAVX2(
+      const float* lefts,
+      const float* tops,
+      const float* rights,
+      const float* bottoms,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags,
+      size_t& intersecting_count
+    ) noexcept;
+    static size_t markIntersectingRectangleSSE2(
+      const float* lefts,
+      const float* tops,
+      const float* rights,
+      const float* bottoms,
+      size_t count,
+      const Rectanglef& rectangle,
+      unsigned char* flags,
+      size_t& intersecting_count
+    ) noexcept;
+    static size_t rotateClockwiseAVX2(
+      float* xs,
+      float* ys,
+      size_t count,
+      float rotation_angle_sin,
+      float rotation_angle_cos
+    ) noexcept;
+    static size_t rotateClockwiseSSE2(
+      float* xs,
+      float* ys,
+      size_t count,
+      float rotation_angle_sin,
+      float rotation_angle_cos
+    ) noexcept;
+    static size_t transformAVX2(
+      float* xs,
+      float* ys,
+      size_t count,
+      float scale,
+      const VectorR2f& offset
+    ) noexcept;
+    static size_t transformSSE2(
+      float* xs,
+      float* ys,
+      size_t count,
+      float scale,
+      const VectorR2f& offset
+    ) noexcept;
+    static void unpackMask(
+      int mask,
+      size_t lanes,
+      unsigned char* flags
+    ) noexcept;
+#endif
+};
+
+#endif // VECTOR_BATCH_H_
@@ -0,0 +1,179 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Voice Manager class - Header file.
+
+// Define guard.
+#ifndef VOICE_MANAGER_H_
+#define VOICE_MANAGER_H_
+
+// Includes.
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_mixer.h>
+
+// Template includes.
+#include "templates/SPSCQueue.hpp"
+
+// Declarations.
+class GameObject;
+struct Voice;
+struct VoiceHandle;
+class VoiceManager;
+struct VoiceStatistics;
+enum VoiceStealPolicy : unsigned short;
+
+// Macros.
+#define VOICE_MANAGER_DEFAULT_PRIORITY 0
+#define VOICE_MANAGER_DEFAULT_VOLUME (MIX_MAX_VOLUME / 2)
+#define VOICE_MANAGER_FINISHED_QUEUE_SIZE 256
+#define VOICE_MANAGER_MAX_CHANNELS 64
+#define VOICE_MANAGER_MERGE_GAIN_LIMIT 2.0
+
+// Enumeration definitions.
+enum VoiceStealPolicy : unsigned short {
+  StealOldestVoice,
+  StealQuietestVoice,
+  StealLowestPriorityVoice
+};
+
+// Type definitions.
+// Volume is per instance, the channel plays it scaled by the merged count.
+// Owners are the objects waiting on the voice, one per merged sound.
+struct Voice {
+  const Mix_Chunk* chunk;
+  unsigned long generation;
+  unsigned long merged_count;
+  std::vector<GameObject*> owners;
+  int priority;
+  unsigned long start_frame;
+  unsigned long start_sequence;
+  int volume;
+};
+
+// The generation tells a voice apart from later ones on the same channel.
+struct VoiceHandle {
+  int channel;
+  unsigned long generation;
+};
+
+struct VoiceStatistics {
+  unsigned long active_voices;
+  unsigned long allocated_channels;
+  unsigned long dropped_voices;
+  unsigned long finished_queue_overflows;
+  unsigned long finished_voices;
+  unsigned long grown_channels;
+  unsigned long merged_voices;
+  unsigned long peak_active_voices;
+  unsigned long started_voices;
+  unsigned long stolen_voices;
+};
+
+// Class definition.
+// Hands out mixer channels to one-shot and looping sounds. When every channel
+// is busy it first grows the channel count up to a cap, then steals the voice
+// picked by the steal policy, never one with a higher priority than the new
+// sound. A sound started again within the same frame joins the voice already
+// playing it, which only gets louder, so a mass kill costs a single channel.
+// The mixer reports finished channels from the audio thread through a queue
+// drained once per frame, so asking whether a voice still plays never takes
+// the audio lock. Every channel is expected to be played through the manager.
+// Owners of finished, stolen or lost voices are handed back in one list, so
+// nobody has to poll the voices they are waiting on.
+class VoiceManager {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    VoiceManager(
+      VoiceStealPolicy steal_policy = StealLowestPriorityVoice,
+      int max_channels = VOICE_MANAGER_MAX_CHANNELS
+    ) noexcept;
+    ~VoiceManager() noexcept;
+
+    // Method prototypes.
+    void advanceFrame() noexcept;
+    VoiceStealPolicy getStealPolicy() const noexcept;
+    const VoiceStatistics& getStatistics() const noexcept;
+    bool isCurrentVoice(const VoiceHandle& voice) const noexcept;
+    int play(
+      Mix_Chunk* chunk,
+      int priority,
+      int volume,
+      int loops,
+      GameObject* owner,
+      VoiceHandle& voice
+    ) noexcept;
+    void release(const VoiceHandle& voice, GameObject* owner) noexcept;
+    void setStealPolicy(VoiceStealPolicy steal_policy) noexcept;
+    void takeFinishedVoiceOwners(
+      std::vector<GameObject*>& finished_voice_owners
+    ) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    VoiceManager(const VoiceManager&) = delete;
+
+    // Members.
+    std::vector<unsigned long> channel_finish_counts;
+    std::vector<unsigned long> channel_start_counts;
+    SPSCQueue<int, VOICE_MANAGER_FINISHED_QUEUE_SIZE> finished_channels;
+    std::atomic<bool> finished_channels_overflowed{false};
+    std::vector<GameObject*> finished_voice_owners;
+    unsigned long frame = 0;
+    std::vector<int> frame_voice_channels;
+    int max_channels;
+    unsigned long next_generation = 0;
+    unsigned long next_start_sequence = 0;
+    VoiceStatistics statistics = {};
+    VoiceStealPolicy steal_policy;
+    std::vector<Voice> voices;
+
+    // Static members.
+    static std::atomic<VoiceManager*> finished_channel_listener;
+
+    // Default operator overloadings.
+    VoiceManager& operator = (const VoiceManager&) = delete;
+
+    // Method prototypes.
+    bool channelHoldsVoice(int channel) const noexcept;
+    void drainFinishedChannels() noexcept;
+    void finishVoiceOwners(int channel) noexcept;
+    int growChannels() noexcept;
+    bool isBetterVictim(
+      const Voice& candidate,
+      const Voice& current_victim
+    ) const noexcept;
+    int mergeIntoFrameVoice(
+      const Mix_Chunk* chunk,
+      int priority,
+      GameObject* owner,
+      VoiceHandle& voice
+    ) noexcept;
+    void resyncFinishedChannels() noexcept;
+    int selectVictimChannel(int priority) const noexcept;
+    void startVoice(
+      int channel,
+      const Mix_Chunk* chunk,
+      int priority,
+      int volume,
+      int loops,
+      GameObject* owner,
+      VoiceHandle& voice
+    ) noexcept;
+    void syncChannelCount() noexcept;
+
+    // Static method prototypes.
+    static void handleChannelFinished(int channel) noexcept;
+    static int mergedVolumeOf(const Voice& voice) noexcept;
+};
+
+#endif // VOICE_MANAGER_H_
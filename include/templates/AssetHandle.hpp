@@ -0,0 +1,124 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Handle class - Template file.
+
+// Define guard.
+#ifndef ASSET_HANDLE_T_
+#define ASSET_HANDLE_T_
+
+// Includes.
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// Declarations.
+enum AssetLoadStatus : unsigned short;
+template <class TAsset> class AssetHandle;
+template <class TAsset> struct AssetSlot;
+
+// Enumeration definitions.
+enum AssetLoadStatus : unsigned short {
+  AssetPending,
+  AssetReady,
+  AssetFailed
+};
+
+// Type definitions.
+template <class TAsset>
+struct AssetSlot {
+  std::atomic<AssetLoadStatus> status{AssetLoadStatus::AssetPending};
+  TAsset asset;
+};
+
+// Class definition.
+template <class TAsset>
+class AssetHandle {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    AssetHandle() noexcept = default;
+    AssetHandle(std::shared_ptr<AssetSlot<TAsset>> slot) noexcept;
+
+    // Method prototypes.
+    void complete(TAsset asset) noexcept;
+    void fail() noexcept;
+    bool failed() const noexcept;
+    const TAsset& get() const noexcept;
+    bool isDone() const noexcept;
+    bool isReady() const noexcept;
+    bool isValid() const noexcept;
+
+  // Private components.
+  private:
+
+    // Members.
+    std::shared_ptr<AssetSlot<TAsset>> slot;
+
+    // Static members.
+    static inline const TAsset empty_asset = TAsset();
+};
+
+// Class method implementations.
+template <class TAsset>
+AssetHandle<TAsset>::AssetHandle(
+  std::shared_ptr<AssetSlot<TAsset>> slot
+) noexcept : slot(std::move(slot)) {};
+
+// Public method implementations.
+template <class TAsset>
+void AssetHandle<TAsset>::complete(TAsset asset) noexcept {
+  // The asset is published before the status, which readers check first.
+  this->slot->asset = std::move(asset);
+  this->slot->status.store(
+    AssetLoadStatus::AssetReady,
+    std::memory_order_release
+  );
+};
+
+template <class TAsset>
+void AssetHandle<TAsset>::fail() noexcept {
+  this->slot->status.store(
+    AssetLoadStatus::AssetFailed,
+    std::memory_order_release
+  );
+};
+
+template <class TAsset>
+bool AssetHandle<TAsset>::failed() const noexcept {
+  return (
+    this->isValid() &&
+    this->slot->status.load(std::memory_order_acquire) == \
+      AssetLoadStatus::AssetFailed
+  );
+};
+
+template <class TAsset>
+const TAsset& AssetHandle<TAsset>::get() const noexcept {
+  if(!this->isReady())
+    return AssetHandle<TAsset>::empty_asset;
+
+  return this->slot->asset;
+};
+
+template <class TAsset>
+bool AssetHandle<TAsset>::isDone() const noexcept {
+  return this->isReady() || this->failed();
+};
+
+template <class TAsset>
+bool AssetHandle<TAsset>::isReady() const noexcept {
+  return (
+    this->isValid() &&
+    this->slot->status.load(std::memory_order_acquire) == \
+      AssetLoadStatus::AssetReady
+  );
+};
+
+template <class TAsset>
+bool AssetHandle<TAsset>::isValid() const noexcept {
+  return this->slot != nullptr;
+};
+
+#endif // ASSET_HANDLE_T_
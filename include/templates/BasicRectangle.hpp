@@ -0,0 +1,215 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Basic Rectangle class - Template file.
+
+// Define guard.
+#ifndef BASIC_RECTANGLE_T_
+#define BASIC_RECTANGLE_T_
+
+// Template includes.
+#include "templates/BasicVectorR2.hpp"
+
+// Declarations.
+template <class TScalar> class BasicRectangle;
+
+// Class definition.
+template <class TScalar>
+class BasicRectangle {
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    constexpr BasicRectangle() noexcept = default;
+    constexpr BasicRectangle(
+      BasicVectorR2<TScalar> upper_left_corner,
+      TScalar width,
+      TScalar height
+    ) noexcept;
+    template <class TOtherScalar>
+    constexpr explicit BasicRectangle(
+      const BasicRectangle<TOtherScalar>& rectangle
+    ) noexcept;
+
+    // Members.
+    TScalar height = 0;
+    BasicVectorR2<TScalar> upper_left_corner;
+    TScalar width = 0;
+
+    // Method prototypes.
+    constexpr BasicVectorR2<TScalar> coordinatesOfCenter() const noexcept;
+    TScalar distanceBetweenCenters(
+      const BasicRectangle& reference
+    ) const noexcept;
+    constexpr bool intersectsWith(
+      const BasicRectangle& reference
+    ) const noexcept;
+    constexpr bool isReferenceInsideOfSelf(
+      const BasicVectorR2<TScalar>& reference
+    ) const noexcept;
+    constexpr bool isReferenceOnTheBoundariesOfSelf(
+      const BasicVectorR2<TScalar>& reference
+    ) const noexcept;
+    constexpr bool isReferenceInsideOrOnTheBoundariesOfSelf(
+      const BasicVectorR2<TScalar>& reference
+    ) const noexcept;
+    constexpr BasicVectorR2<TScalar> vectorFromUpperLeftCornerToCenter() \
+    const noexcept;
+};
+
+// Class method implementations.
+template <class TScalar>
+constexpr BasicRectangle<TScalar>::BasicRectangle(
+  BasicVectorR2<TScalar> upper_left_corner,
+  TScalar width,
+  TScalar height
+) noexcept :
+  height(height),
+  upper_left_corner(upper_left_corner),
+  width(width) {};
+
+template <class TScalar>
+template <class TOtherScalar>
+constexpr BasicRectangle<TScalar>::BasicRectangle(
+  const BasicRectangle<TOtherScalar>& rectangle
+) noexcept :
+  height((TScalar) rectangle.height),
+  upper_left_corner(rectangle.upper_left_corner),
+  width((TScalar) rectangle.width) {};
+
+// Public method implementations.
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> \
+BasicRectangle<TScalar>::coordinatesOfCenter() const noexcept {
+  return this->upper_left_corner + this->vectorFromUpperLeftCornerToCenter();
+};
+
+template <class TScalar>
+TScalar BasicRectangle<TScalar>::distanceBetweenCenters(
+  const BasicRectangle& reference
+) const noexcept {
+  return this->coordinatesOfCenter().distanceTo(
+    reference.coordinatesOfCenter()
+  );
+};
+
+template <class TScalar>
+constexpr bool BasicRectangle<TScalar>::intersectsWith(
+  const BasicRectangle& reference
+) const noexcept {
+  const BasicVectorR2<TScalar>& reference_corner = reference.upper_left_corner;
+
+  return (
+    reference_corner.x < this->upper_left_corner.x + this->width &&
+    reference_corner.x + reference.width > this->upper_left_corner.x &&
+    reference_corner.y < this->upper_left_corner.y + this->height &&
+    reference_corner.y + reference.height > this->upper_left_corner.y
+  );
+};
+
+template <class TScalar>
+constexpr bool BasicRectangle<TScalar>::isReferenceInsideOfSelf(
+  const BasicVectorR2<TScalar>& reference
+) const noexcept {
+  return (
+    reference.x > this->upper_left_corner.x &&
+    reference.x < this->upper_left_corner.x + this->width &&
+    reference.y > this->upper_left_corner.y &&
+    reference.y < this->upper_left_corner.y + this->height
+  );
+};
+
+template <class TScalar>
+constexpr bool BasicRectangle<TScalar>::isReferenceOnTheBoundariesOfSelf(
+  const BasicVectorR2<TScalar>& reference
+) const noexcept {
+  return (
+    (
+      reference.x == this->upper_left_corner.x ||
+      reference.x == this->upper_left_corner.x + this->width
+    ) &&
+    reference.y >= this->upper_left_corner.y &&
+    reference.y <= this->upper_left_corner.y + this->height
+  ) || (
+    (
+      reference.y == this->upper_left_corner.y ||
+      reference.y == this->upper_left_corner.y + this->height
+    ) &&
+    reference.x > this->upper_left_corner.x &&
+    reference.x < this->upper_left_corner.x + this->width
+  );
+};
+
+template <class TScalar>
+constexpr bool \
+BasicRectangle<TScalar>::isReferenceInsideOrOnTheBoundariesOfSelf(
+  const BasicVectorR2<TScalar>& reference
+) const noexcept {
+  return (
+    reference.x >= this->upper_left_corner.x &&
+    reference.x <= this->upper_left_corner.x + this->width &&
+    reference.y >= this->upper_left_corner.y &&
+    reference.y <= this->upper_left_corner.y + this->height
+  );
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> \
+BasicRectangle<TScalar>::vectorFromUpperLeftCornerToCenter() const noexcept {
+  return BasicVectorR2<TScalar>(this->width / 2, this->height / 2);
+};
+
+// Class operator implementations.
+template <class TScalar>
+constexpr BasicRectangle<TScalar> operator + (
+  const BasicRectangle<TScalar>& rectangle,
+  const BasicVectorR2<TScalar>& vectorR2
+) noexcept {
+  return BasicRectangle<TScalar>(
+    rectangle.upper_left_corner + vectorR2,
+    rectangle.width,
+    rectangle.height
+  );
+};
+
+template <class TScalar>
+constexpr BasicRectangle<TScalar> operator + (
+  const BasicVectorR2<TScalar>& vectorR2,
+  const BasicRectangle<TScalar>& rectangle
+) noexcept {
+  return rectangle + vectorR2;
+};
+
+template <class TScalar>
+constexpr BasicRectangle<TScalar>& operator += (
+  BasicRectangle<TScalar>& rectangle,
+  const BasicVectorR2<TScalar>& vectorR2
+) noexcept {
+  rectangle.upper_left_corner += vectorR2;
+
+  return rectangle;
+};
+
+template <class TScalar>
+constexpr BasicRectangle<TScalar> operator - (
+  const BasicRectangle<TScalar>& rectangle,
+  const BasicVectorR2<TScalar>& vectorR2
+) noexcept {
+  return BasicRectangle<TScalar>(
+    rectangle.upper_left_corner - vectorR2,
+    rectangle.width,
+    rectangle.height
+  );
+};
+
+template <class TScalar>
+constexpr BasicRectangle<TScalar>& operator -= (
+  BasicRectangle<TScalar>& rectangle,
+  const BasicVectorR2<TScalar>& vectorR2
+) noexcept {
+  rectangle.upper_left_corner -= vectorR2;
+
+  return rectangle;
+};
+
+#endif // BASIC_RECTANGLE_T_
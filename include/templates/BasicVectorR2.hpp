@@ -0,0 +1,260 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Basic Vector R2 class - Template file.
+
+// Define guard.
+#ifndef BASIC_VECTOR_R2_T_
+#define BASIC_VECTOR_R2_T_
+
+// Includes.
+#include <cmath>
+#include <type_traits>
+
+// Declarations.
+template <class TScalar> class BasicVectorR2;
+
+// Class definition.
+// Everything lives in the header, so calls inline across translation units.
+template <class TScalar>
+class BasicVectorR2 {
+  // Construction pre-requisites.
+  static_assert(
+    std::is_floating_point<TScalar>::value,
+    "TScalar must be a floating point type."
+  );
+
+  // Public components.
+  public:
+
+    // Type definitions.
+    using scalar_type = TScalar;
+
+    // Class method prototypes.
+    constexpr BasicVectorR2() noexcept = default;
+    constexpr BasicVectorR2(TScalar x, TScalar y) noexcept;
+    template <class TOtherScalar>
+    constexpr explicit BasicVectorR2(
+      const BasicVectorR2<TOtherScalar>& vector
+    ) noexcept;
+
+    // Members.
+    TScalar x = 0;
+    TScalar y = 0;
+
+    // Method prototypes.
+    TScalar angleInRadiansFromSelfTo(
+      const BasicVectorR2& reference
+    ) const noexcept;
+    TScalar angleInRadiansFromXAxisToSelf() const noexcept;
+    TScalar angleInRadiansFromXAxisToSlopeConnectingSelfTo(
+      const BasicVectorR2& reference
+    ) const noexcept;
+    BasicVectorR2 clockwiseRotatedVector(
+      TScalar rotation_angle_in_radians
+    ) const noexcept;
+    constexpr BasicVectorR2 clockwiseRotatedVector(
+      TScalar rotation_angle_sin,
+      TScalar rotation_angle_cos
+    ) const noexcept;
+    BasicVectorR2 counterClockwiseRotatedVector(
+      TScalar rotation_angle_in_radians
+    ) const noexcept;
+    TScalar distanceTo(const BasicVectorR2& reference) const noexcept;
+    constexpr TScalar dotProductWith(
+      const BasicVectorR2& vector
+    ) const noexcept;
+    TScalar magnitude() const noexcept;
+    BasicVectorR2 normalizedVector() const noexcept;
+    void normalizeSelf() noexcept;
+    void rotateSelfClockwise(TScalar rotation_angle_in_radians) noexcept;
+    void rotateSelfCounterClockwise(
+      TScalar rotation_angle_in_radians
+    ) noexcept;
+    constexpr TScalar squaredMagnitude() const noexcept;
+};
+
+// Class method implementations.
+template <class TScalar>
+constexpr BasicVectorR2<TScalar>::BasicVectorR2(
+  TScalar x,
+  TScalar y
+) noexcept : x(x), y(y) {};
+
+template <class TScalar>
+template <class TOtherScalar>
+constexpr BasicVectorR2<TScalar>::BasicVectorR2(
+  const BasicVectorR2<TOtherScalar>& vector
+) noexcept : x((TScalar) vector.x), y((TScalar) vector.y) {};
+
+// Public method implementations.
+template <class TScalar>
+TScalar BasicVectorR2<TScalar>::angleInRadiansFromSelfTo(
+  const BasicVectorR2& reference
+) const noexcept {
+  return std::acos(
+    this->dotProductWith(reference) /
+    (this->magnitude() * reference.magnitude())
+  );
+};
+
+template <class TScalar>
+TScalar BasicVectorR2<TScalar>::angleInRadiansFromXAxisToSelf() \
+const noexcept {
+  return std::atan2(this->y, this->x);
+};
+
+template <class TScalar>
+TScalar BasicVectorR2<TScalar>::angleInRadiansFromXAxisToSlopeConnectingSelfTo(
+  const BasicVectorR2& reference
+) const noexcept {
+  return (reference - *this).angleInRadiansFromXAxisToSelf();
+};
+
+template <class TScalar>
+BasicVectorR2<TScalar> BasicVectorR2<TScalar>::clockwiseRotatedVector(
+  TScalar rotation_angle_in_radians
+) const noexcept {
+  return this->clockwiseRotatedVector(
+    std::sin(rotation_angle_in_radians),
+    std::cos(rotation_angle_in_radians)
+  );
+};
+
+// Callers rotating many vectors by one angle compute its sine and cosine once.
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> BasicVectorR2<TScalar>::clockwiseRotatedVector(
+  TScalar rotation_angle_sin,
+  TScalar rotation_angle_cos
+) const noexcept {
+  return BasicVectorR2(
+    this->x * rotation_angle_cos - this->y * rotation_angle_sin,
+    this->y * rotation_angle_cos + this->x * rotation_angle_sin
+  );
+};
+
+template <class TScalar>
+BasicVectorR2<TScalar> BasicVectorR2<TScalar>::counterClockwiseRotatedVector(
+  TScalar rotation_angle_in_radians
+) const noexcept {
+  return this->clockwiseRotatedVector(-rotation_angle_in_radians);
+};
+
+template <class TScalar>
+TScalar BasicVectorR2<TScalar>::distanceTo(
+  const BasicVectorR2& reference
+) const noexcept {
+  return (*this - reference).magnitude();
+};
+
+template <class TScalar>
+constexpr TScalar BasicVectorR2<TScalar>::dotProductWith(
+  const BasicVectorR2& vector
+) const noexcept {
+  return (this->x * vector.x) + (this->y * vector.y);
+};
+
+template <class TScalar>
+TScalar BasicVectorR2<TScalar>::magnitude() const noexcept {
+  return std::sqrt(this->squaredMagnitude());
+};
+
+template <class TScalar>
+BasicVectorR2<TScalar> BasicVectorR2<TScalar>::normalizedVector() \
+const noexcept {
+  TScalar vector_magnitude = this->magnitude();
+
+  return BasicVectorR2(
+    this->x / vector_magnitude,
+    this->y / vector_magnitude
+  );
+};
+
+template <class TScalar>
+void BasicVectorR2<TScalar>::normalizeSelf() noexcept {
+  *this = this->normalizedVector();
+};
+
+template <class TScalar>
+void BasicVectorR2<TScalar>::rotateSelfClockwise(
+  TScalar rotation_angle_in_radians
+) noexcept {
+  *this = this->clockwiseRotatedVector(rotation_angle_in_radians);
+};
+
+template <class TScalar>
+void BasicVectorR2<TScalar>::rotateSelfCounterClockwise(
+  TScalar rotation_angle_in_radians
+) noexcept {
+  *this = this->counterClockwiseRotatedVector(rotation_angle_in_radians);
+};
+
+template <class TScalar>
+constexpr TScalar BasicVectorR2<TScalar>::squaredMagnitude() const noexcept {
+  return this->dotProductWith(*this);
+};
+
+// Class operator implementations.
+// Scalars are taken as scalar_type, so literals of any type convert.
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> operator + (
+  const BasicVectorR2<TScalar>& lhs,
+  const BasicVectorR2<TScalar>& rhs
+) noexcept {
+  return BasicVectorR2<TScalar>(lhs.x + rhs.x, lhs.y + rhs.y);
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar>& operator += (
+  BasicVectorR2<TScalar>& lhs,
+  const BasicVectorR2<TScalar>& rhs
+) noexcept {
+  lhs.x += rhs.x;
+  lhs.y += rhs.y;
+
+  return lhs;
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> operator - (
+  const BasicVectorR2<TScalar>& operand
+) noexcept {
+  return BasicVectorR2<TScalar>(-operand.x, -operand.y);
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> operator - (
+  const BasicVectorR2<TScalar>& lhs,
+  const BasicVectorR2<TScalar>& rhs
+) noexcept {
+  return BasicVectorR2<TScalar>(lhs.x - rhs.x, lhs.y - rhs.y);
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar>& operator -= (
+  BasicVectorR2<TScalar>& lhs,
+  const BasicVectorR2<TScalar>& rhs
+) noexcept {
+  lhs.x -= rhs.x;
+  lhs.y -= rhs.y;
+
+  return lhs;
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> operator * (
+  const typename BasicVectorR2<TScalar>::scalar_type scalar,
+  const BasicVectorR2<TScalar>& vector
+) noexcept {
+  return BasicVectorR2<TScalar>(scalar * vector.x, scalar * vector.y);
+};
+
+template <class TScalar>
+constexpr BasicVectorR2<TScalar> operator * (
+  const BasicVectorR2<TScalar>& vector,
+  const typename BasicVectorR2<TScalar>::scalar_type scalar
+) noexcept {
+  return BasicVectorR2<TScalar>(vector.x * scalar, vector.y * scalar);
+};
+
+#endif // BASIC_VECTOR_R2_T_
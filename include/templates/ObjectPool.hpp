@@ -0,0 +1,120 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Object Pool class - Template file.
+
+// Define guard.
+#ifndef OBJECT_POOL_T_
+#define OBJECT_POOL_T_
+
+// Includes.
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Declarations.
+template <class TObject, size_t TSlotsPerBlock> class ObjectPool;
+struct PoolStatistics;
+
+// Type definitions.
+struct PoolStatistics {
+  size_t live_objects;
+  size_t high_water_mark;
+  size_t bytes_reserved;
+};
+
+// Class definition.
+template <class TObject, size_t TSlotsPerBlock = 64>
+class ObjectPool {
+  // Construction pre-requisites.
+  static_assert(TSlotsPerBlock > 0, "TSlotsPerBlock must be positive.");
+
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    ObjectPool() noexcept = default;
+
+    // Method prototypes.
+    void* allocate();
+    void deallocate(void* object) noexcept;
+    PoolStatistics getStatistics() const noexcept;
+
+  // Private components.
+  private:
+
+    // Type definitions.
+    union Slot {
+      Slot* next_free_slot;
+      alignas(TObject) unsigned char storage[sizeof(TObject)];
+    };
+
+    // Class method prototypes.
+    ObjectPool(const ObjectPool&) = delete;
+
+    // Members.
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+    Slot* free_slots = nullptr;
+    size_t high_water_mark = 0;
+    size_t live_objects = 0;
+
+    // Default operator overloadings.
+    ObjectPool& operator = (const ObjectPool&) = delete;
+
+    // Method prototypes.
+    void reserveBlock();
+};
+
+// Public method implementations.
+template <class TObject, size_t TSlotsPerBlock>
+void* ObjectPool<TObject, TSlotsPerBlock>::allocate() {
+  Slot* allocated_slot;
+
+  if(this->free_slots == nullptr)
+    this->reserveBlock();
+
+  allocated_slot = this->free_slots;
+  this->free_slots = allocated_slot->next_free_slot;
+
+  this->live_objects++;
+  if(this->live_objects > this->high_water_mark)
+    this->high_water_mark = this->live_objects;
+
+  return allocated_slot->storage;
+};
+
+template <class TObject, size_t TSlotsPerBlock>
+void ObjectPool<TObject, TSlotsPerBlock>::deallocate(void* object) noexcept {
+  Slot* released_slot = reinterpret_cast<Slot*>(object);
+
+  released_slot->next_free_slot = this->free_slots;
+  this->free_slots = released_slot;
+  this->live_objects--;
+};
+
+template <class TObject, size_t TSlotsPerBlock>
+PoolStatistics ObjectPool<TObject, TSlotsPerBlock>::getStatistics() \
+const noexcept {
+  return {
+    .live_objects = this->live_objects,
+    .high_water_mark = this->high_water_mark,
+    .bytes_reserved = this->blocks.size() * TSlotsPerBlock * sizeof(Slot)
+  };
+};
+
+// Private method implementations.
+template <class TObject, size_t TSlotsPerBlock>
+void ObjectPool<TObject, TSlotsPerBlock>::reserveBlock() {
+  Slot* new_block;
+
+  this->blocks.emplace_back(new Slot[TSlotsPerBlock]);
+  new_block = this->blocks.back().get();
+
+  // Thread the new slots onto the free list, lowest address first.
+  for(size_t slot = TSlotsPerBlock; slot > 0; slot--) {
+    new_block[slot - 1].next_free_slot = this->free_slots;
+    this->free_slots = &new_block[slot - 1];
+  }
+};
+
+#endif // OBJECT_POOL_T_
@@ -0,0 +1,71 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Pool Allocated class - Template file.
+
+// Define guard.
+#ifndef POOL_ALLOCATED_T_
+#define POOL_ALLOCATED_T_
+
+// Includes.
+#include <cstddef>
+#include <new>
+
+// Template includes.
+#include "../templates/ObjectPool.hpp"
+
+// Declarations.
+template <class TDerived> class PoolAllocated;
+
+// Class definition.
+template <class TDerived>
+class PoolAllocated {
+  // Public components.
+  public:
+
+    // Operator overloadings.
+    static void* operator new(size_t size);
+    static void operator delete(void* object, size_t size) noexcept;
+
+    // Static method prototypes.
+    static PoolStatistics poolStatistics() noexcept;
+
+  // Private components.
+  private:
+
+    // Static members.
+    static inline ObjectPool<TDerived> pool;
+};
+
+// Operator implementations.
+template <class TDerived>
+void* PoolAllocated<TDerived>::operator new(size_t size) {
+  // Classes deriving further from TDerived do not fit its slots.
+  if(size != sizeof(TDerived))
+    return ::operator new(size);
+
+  return PoolAllocated<TDerived>::pool.allocate();
+};
+
+template <class TDerived>
+void PoolAllocated<TDerived>::operator delete(
+  void* object,
+  size_t size
+) noexcept {
+  if(object == nullptr)
+    return;
+
+  if(size != sizeof(TDerived))
+    ::operator delete(object);
+
+  else
+    PoolAllocated<TDerived>::pool.deallocate(object);
+};
+
+// Static method implementations.
+template <class TDerived>
+PoolStatistics PoolAllocated<TDerived>::poolStatistics() noexcept {
+  return PoolAllocated<TDerived>::pool.getStatistics();
+};
+
+#endif // POOL_ALLOCATED_T_
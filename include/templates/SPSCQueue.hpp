@@ -0,0 +1,83 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - SPSC Queue class - Template file.
+
+// Define guard.
+#ifndef SPSC_QUEUE_T_
+#define SPSC_QUEUE_T_
+
+// Includes.
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// Declarations.
+template <class TValue, size_t TCapacity> class SPSCQueue;
+
+// Class definition.
+// Bounded lock-free queue for one producer and one consumer thread. Pushing
+// never blocks nor allocates, so it is safe from the audio callback. Several
+// threads may take turns producing as long as something else orders them.
+template <class TValue, size_t TCapacity>
+class SPSCQueue {
+  // Construction pre-requisites.
+  static_assert(
+    TCapacity > 0 && (TCapacity & (TCapacity - 1)) == 0,
+    "TCapacity must be a power of two."
+  );
+
+  // Public components.
+  public:
+
+    // Class method prototypes.
+    SPSCQueue() noexcept = default;
+
+    // Method prototypes.
+    bool tryPop(TValue& value) noexcept;
+    bool tryPush(const TValue& value) noexcept;
+
+  // Private components.
+  private:
+
+    // Class method prototypes.
+    SPSCQueue(const SPSCQueue&) = delete;
+
+    // Members.
+    // Each index is written by one side only, so they get separate lines.
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    std::array<TValue, TCapacity> values;
+
+    // Default operator overloadings.
+    SPSCQueue& operator = (const SPSCQueue&) = delete;
+};
+
+// Public method implementations.
+template <class TValue, size_t TCapacity>
+bool SPSCQueue<TValue, TCapacity>::tryPop(TValue& value) noexcept {
+  size_t current_head = this->head.load(std::memory_order_relaxed);
+
+  if(current_head == this->tail.load(std::memory_order_acquire))
+    return false;
+
+  value = this->values[current_head & (TCapacity - 1)];
+  this->head.store(current_head + 1, std::memory_order_release);
+
+  return true;
+};
+
+template <class TValue, size_t TCapacity>
+bool SPSCQueue<TValue, TCapacity>::tryPush(const TValue& value) noexcept {
+  size_t current_tail = this->tail.load(std::memory_order_relaxed);
+
+  if(current_tail - this->head.load(std::memory_order_acquire) == TCapacity)
+    return false;
+
+  this->values[current_tail & (TCapacity - 1)] = value;
+  this->tail.store(current_tail + 1, std::memory_order_release);
+
+  return true;
+};
+
+#endif // SPSC_QUEUE_T_
@@ -0,0 +1,361 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Archive class - Source code.
+
+// Class header include.
+#include "AssetArchive.hpp"
+
+// Class method implementations.
+AssetArchive::AssetArchive(const AssetManifest& asset_manifest) noexcept :
+  asset_manifest(asset_manifest) {};
+
+AssetArchive::~AssetArchive() noexcept {
+  this->close();
+};
+
+// Public method implementations.
+void AssetArchive::close() noexcept {
+  // Asset streams still reading from the mapping must be closed beforehand.
+  if(this->mapped_data != nullptr)
+    munmap((void*) this->mapped_data, this->mapped_size);
+
+  this->index.clear();
+  this->mapped_data = nullptr;
+  this->mapped_size = 0;
+};
+
+bool AssetArchive::contains(const std::string& id) const noexcept {
+  return this->index.count(id) != 0;
+};
+
+std::string AssetArchiveErrorDescription::describeErrorCause(
+  AssetArchiveErrorCode error_code
+) const noexcept {
+  std::string error_cause = std::string("This error was caused by ");
+
+  switch (error_code) {
+    case AssetArchiveErrorCode::OpenAssetArchiveError:
+      error_cause += "attempting to map the asset archive into memory";
+      break;
+    case AssetArchiveErrorCode::InvalidAssetArchiveError:
+      error_cause += "a truncated or corrupted asset archive";
+      break;
+    case AssetArchiveErrorCode::LongAssetIdError:
+      error_cause += "an asset id too long to fit in the archive index";
+      break;
+    case AssetArchiveErrorCode::ReadAssetFileError:
+      error_cause += "attempting to read an asset listed in the manifest";
+      break;
+    case AssetArchiveErrorCode::WriteAssetArchiveError:
+      error_cause += "attempting to write the asset archive to the file "
+        "system";
+      break;
+    case AssetArchiveErrorCode::ConvertTextureError:
+      error_cause += "attempting to convert a texture to the raw format";
+      break;
+  }
+
+  error_cause += ".";
+
+  return error_cause;
+};
+
+std::string AssetArchiveErrorDescription::describeErrorDetails(
+  AssetArchiveErrorCode error_code
+) const noexcept {
+  std::string error_details;
+
+  switch (error_code) {
+    case AssetArchiveErrorCode::InvalidAssetArchiveError:
+      error_details += "Rebuild the archive with \"make pack\"";
+      break;
+    case AssetArchiveErrorCode::LongAssetIdError:
+      error_details += "Asset ids must be shorter than " + \
+        std::to_string(ASSET_ARCHIVE_ID_SIZE) + " characters";
+      break;
+    // File system failures leave their cause in errno, not in SDL.
+    case AssetArchiveErrorCode::OpenAssetArchiveError:
+    case AssetArchiveErrorCode::ReadAssetFileError:
+    case AssetArchiveErrorCode::WriteAssetArchiveError:
+      error_details += std::strerror(errno);
+      break;
+    default:
+      error_details += SDL_GetError();
+      break;
+  }
+
+  error_details += ".";
+
+  return error_details;
+};
+
+std::string AssetArchiveErrorDescription::describeErrorSummary() \
+const noexcept {
+  std::string error_summary = std::string(
+    "AssetArchiveError: An error occurred when handling the asset archive!"
+  );
+
+  return error_summary;
+};
+
+int AssetArchive::findAsset(
+  const std::string& id,
+  const unsigned char*& asset_data,
+  size_t& asset_size
+) const noexcept {
+  auto index_entry = this->index.find(id);
+
+  if(index_entry == this->index.end())
+    return -1;
+
+  asset_data = this->mapped_data + index_entry->second.data_offset;
+  asset_size = index_entry->second.data_size;
+
+  return 0;
+};
+
+bool AssetArchive::isOpen() const noexcept {
+  return this->mapped_data != nullptr;
+};
+
+void AssetArchive::open(const std::string& archive_file) {
+  struct stat archive_status;
+  void* mapped_data;
+  int archive_descriptor = ::open(archive_file.c_str(), O_RDONLY);
+  int saved_errno = errno;
+
+  this->close();
+
+  // Cleanup calls may overwrite errno, so it is restored before each throw.
+  if(archive_descriptor < 0) {
+    errno = saved_errno;
+    throw AssetArchiveException(AssetArchiveErrorCode::OpenAssetArchiveError);
+  }
+
+  if(fstat(archive_descriptor, &archive_status) != 0) {
+    saved_errno = errno;
+    ::close(archive_descriptor);
+    errno = saved_errno;
+    throw AssetArchiveException(AssetArchiveErrorCode::OpenAssetArchiveError);
+  }
+
+  if((size_t) archive_status.st_size < sizeof(AssetArchiveHeader)) {
+    ::close(archive_descriptor);
+    throw AssetArchiveException(
+      AssetArchiveErrorCode::InvalidAssetArchiveError
+    );
+  }
+
+  // The mapping outlives the descriptor, and pages load only when touched.
+  mapped_data = mmap(
+    nullptr,
+    archive_status.st_size,
+    PROT_READ,
+    MAP_PRIVATE,
+    archive_descriptor,
+    0
+  );
+  saved_errno = errno;
+  ::close(archive_descriptor);
+
+  if(mapped_data == MAP_FAILED) {
+    errno = saved_errno;
+    throw AssetArchiveException(AssetArchiveErrorCode::OpenAssetArchiveError);
+  }
+
+  this->mapped_data = (const unsigned char*) mapped_data;
+  this->mapped_size = archive_status.st_size;
+
+  // Every asset is read during the first frames, so ask for readahead.
+  madvise(mapped_data, this->mapped_size, MADV_WILLNEED);
+
+  if(this->readIndex() != 0) {
+    this->close();
+    throw AssetArchiveException(
+      AssetArchiveErrorCode::InvalidAssetArchiveError
+    );
+  }
+};
+
+SDL_RWops* AssetArchive::openAsset(const std::string& id) const noexcept {
+  auto index_entry = this->index.find(id);
+
+  // Archived assets are read in place, so decoding never copies the file.
+  if(index_entry != this->index.end())
+    return SDL_RWFromConstMem(
+      this->mapped_data + index_entry->second.data_offset,
+      (int) index_entry->second.data_size
+    );
+
+  // Loose files back up assets missing from the archive (e.g. during work).
+  if(this->asset_manifest.contains(id))
+    return SDL_RWFromFile(this->asset_manifest.pathOf(id).c_str(), "rb");
+
+  return SDL_RWFromFile(id.c_str(), "rb");
+};
+
+size_t AssetArchive::size() const noexcept {
+  return this->index.size();
+};
+
+size_t AssetArchive::pack(
+  const AssetManifest& asset_manifest,
+  const std::string& archive_file,
+  const AssetPackOptions& pack_options
+) {
+  AssetArchiveHeader header = {};
+  std::vector<AssetArchiveIndexEntry> index;
+  uint64_t offset = sizeof(AssetArchiveHeader);
+  std::ofstream archive_stream(
+    archive_file,
+    std::ios::binary | std::ios::trunc
+  );
+
+  if(!archive_stream.is_open())
+    throw AssetArchiveException(AssetArchiveErrorCode::WriteAssetArchiveError);
+
+  // The header is rewritten last, once the index offset is known.
+  archive_stream.write((const char*) &header, sizeof(AssetArchiveHeader));
+
+  for(const AssetManifestEntry& entry : asset_manifest.getEntries()) {
+    AssetArchiveIndexEntry index_entry = {};
+    std::vector<unsigned char> asset_data;
+
+    if(entry.id.size() >= ASSET_ARCHIVE_ID_SIZE)
+      throw AssetArchiveException(AssetArchiveErrorCode::LongAssetIdError);
+
+    AssetArchive::readAssetData(entry, pack_options, asset_data);
+
+    offset = AssetArchive::alignedOffset(offset);
+    AssetArchive::padToOffset(archive_stream, offset);
+    archive_stream.write((const char*) asset_data.data(), asset_data.size());
+
+    std::memcpy(index_entry.id, entry.id.c_str(), entry.id.size());
+    index_entry.kind = entry.kind;
+    index_entry.data_offset = offset;
+    index_entry.data_size = asset_data.size();
+    index.push_back(index_entry);
+
+    offset += asset_data.size();
+  }
+
+  offset = AssetArchive::alignedOffset(offset);
+  AssetArchive::padToOffset(archive_stream, offset);
+  archive_stream.write(
+    (const char*) index.data(),
+    index.size() * sizeof(AssetArchiveIndexEntry)
+  );
+
+  std::memcpy(header.magic, ASSET_ARCHIVE_MAGIC, ASSET_ARCHIVE_MAGIC_SIZE);
+  header.version = ASSET_ARCHIVE_VERSION;
+  header.entry_count = index.size();
+  header.index_offset = offset;
+
+  archive_stream.seekp(0);
+  archive_stream.write((const char*) &header, sizeof(AssetArchiveHeader));
+  archive_stream.flush();
+
+  if(!archive_stream.good())
+    throw AssetArchiveException(AssetArchiveErrorCode::WriteAssetArchiveError);
+
+  return index.size();
+};
+
+// Private method implementations.
+uint64_t AssetArchive::alignedOffset(uint64_t offset) noexcept {
+  uint64_t misalignment = offset % ASSET_ARCHIVE_DATA_ALIGNMENT;
+
+  if(misalignment == 0)
+    return offset;
+
+  return offset + ASSET_ARCHIVE_DATA_ALIGNMENT - misalignment;
+};
+
+void AssetArchive::padToOffset(
+  std::ofstream& archive_stream,
+  uint64_t offset
+) {
+  while((uint64_t) archive_stream.tellp() < offset)
+    archive_stream.put('\0');
+};
+
+void AssetArchive::readAssetData(
+  const AssetManifestEntry& entry,
+  const AssetPackOptions& pack_options,
+  std::vector<unsigned char>& asset_data
+) {
+  std::ifstream asset_stream;
+
+  // Textures may be decoded here once, instead of at every launch.
+  if(pack_options.raw_textures && entry.kind == AssetKind::TextureAsset) {
+    if(
+      RawTexture::encodeImageFile(
+        entry.file,
+        pack_options.texture_compression,
+        asset_data
+      ) != 0
+    )
+      throw AssetArchiveException(AssetArchiveErrorCode::ConvertTextureError);
+
+    return;
+  }
+
+  asset_stream.open(entry.file, std::ios::binary);
+
+  if(!asset_stream.is_open())
+    throw AssetArchiveException(AssetArchiveErrorCode::ReadAssetFileError);
+
+  asset_data.assign(
+    std::istreambuf_iterator<char>(asset_stream),
+    std::istreambuf_iterator<char>()
+  );
+};
+
+int AssetArchive::readIndex() noexcept {
+  AssetArchiveHeader header;
+  AssetArchiveIndexEntry index_entry;
+  uint64_t index_size;
+
+  // Fields are copied out, since the mapping makes no alignment promises.
+  std::memcpy(&header, this->mapped_data, sizeof(AssetArchiveHeader));
+
+  if(
+    std::memcmp(header.magic, ASSET_ARCHIVE_MAGIC, ASSET_ARCHIVE_MAGIC_SIZE) \
+      != 0 ||
+    header.version != ASSET_ARCHIVE_VERSION ||
+    header.index_offset > this->mapped_size
+  )
+    return -1;
+
+  index_size = (uint64_t) header.entry_count * sizeof(AssetArchiveIndexEntry);
+
+  if(index_size > this->mapped_size - header.index_offset)
+    return -1;
+
+  try {
+    for(uint32_t entry = 0; entry < header.entry_count; entry++) {
+      std::memcpy(
+        &index_entry,
+        this->mapped_data + header.index_offset + \
+          entry * sizeof(AssetArchiveIndexEntry),
+        sizeof(AssetArchiveIndexEntry)
+      );
+
+      if(
+        index_entry.id[ASSET_ARCHIVE_ID_SIZE - 1] != '\0' ||
+        index_entry.data_offset > this->mapped_size ||
+        index_entry.data_size > this->mapped_size - index_entry.data_offset ||
+        index_entry.data_size > INT32_MAX
+      )
+        return -1;
+
+      this->index.emplace(std::string(index_entry.id), index_entry);
+    }
+  }
+  catch(std::exception& e) {
+    return -1;
+  }
+
+  return 0;
+};
@@ -0,0 +1,466 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Loader class - Source code.
+
+// Class header include.
+#include "AssetLoader.hpp"
+
+// Class method implementations.
+AssetLoader::AssetLoader(
+  const AssetArchive& asset_archive,
+  TextureCache& texture_cache,
+  SoundChunkCache& sound_chunk_cache
+) :
+  asset_archive(asset_archive),
+  sound_chunk_cache(sound_chunk_cache),
+  texture_cache(texture_cache)
+{
+  unsigned int worker_count = AssetLoader::defaultWorkerCount();
+
+  // Started last, so workers only ever see fully constructed members.
+  for(unsigned int worker = 0; worker < worker_count; worker++)
+    this->workers.emplace_back(&AssetLoader::runWorker, this);
+};
+
+AssetLoader::~AssetLoader() noexcept {
+  {
+    std::lock_guard<std::mutex> jobs_lock(this->jobs_mutex);
+    this->stop_requested = true;
+  }
+
+  this->pending_condition.notify_all();
+
+  for(std::thread& worker : this->workers)
+    if(worker.joinable())
+      worker.join();
+
+  // Loads that never reached the main thread fail instead of dangling.
+  for(auto* job_queue : {&this->pending_jobs, &this->decoded_jobs})
+    for(AssetLoadJob& job : *job_queue) {
+      AssetLoader::freeDecodedData(job);
+      this->failJob(job);
+    }
+};
+
+// Public method implementations.
+size_t AssetLoader::countPendingLoads() const noexcept {
+  return this->requested_loads - this->completed_loads;
+};
+
+unsigned long AssetLoader::getCompletedLoadCount() const noexcept {
+  return this->completed_loads;
+};
+
+unsigned long AssetLoader::getRequestedLoadCount() const noexcept {
+  return this->requested_loads;
+};
+
+void AssetLoader::requestManifestAssets(
+  const AssetManifest& manifest,
+  SDL_Renderer* renderer
+) {
+  // Music is streamed and not cached, so its owner requests it on demand.
+  for(const AssetManifestEntry& entry : manifest.getEntries()) {
+    if(entry.kind == AssetKind::TextureAsset)
+      this->requestTexture(renderer, entry.id);
+    else if(entry.kind == AssetKind::SoundChunkAsset)
+      this->requestSoundChunk(entry.id);
+  }
+};
+
+MusicHandle AssetLoader::requestMusic(const std::string& id) {
+  MusicHandle music_handle = MusicHandle(
+    std::make_shared<AssetSlot<DecodedMusic>>()
+  );
+
+  this->enqueueJob({
+    .kind = AssetKind::MusicAsset,
+    .id = id,
+    .renderer = nullptr,
+    .music_handle = music_handle,
+    .sound_chunk_handle = SoundChunkHandle(),
+    .texture_handle = TextureHandle(),
+    .decoded_chunk = nullptr,
+    .decoded_music = nullptr,
+    .decoded_surface = nullptr,
+    .decode_error = std::string(),
+    .decode_time = 0
+  });
+
+  return music_handle;
+};
+
+SoundChunkHandle AssetLoader::requestSoundChunk(const std::string& id) {
+  SoundChunkHandle sound_chunk_handle;
+  auto in_flight_entry = this->in_flight_sound_chunks.find(id);
+
+  // Entries the workers failed never reach completion, so they go here.
+  if(in_flight_entry != this->in_flight_sound_chunks.end()) {
+    if(!in_flight_entry->second.failed())
+      return in_flight_entry->second;
+
+    this->in_flight_sound_chunks.erase(in_flight_entry);
+  }
+
+  sound_chunk_handle = SoundChunkHandle(
+    std::make_shared<AssetSlot<MixChunkSharedPTR>>()
+  );
+
+  // Already cached assets complete at once, without a trip to the worker.
+  if(this->sound_chunk_cache.contains(id)) {
+    sound_chunk_handle.complete(this->sound_chunk_cache.acquire(id));
+    return sound_chunk_handle;
+  }
+
+  this->enqueueJob({
+    .kind = AssetKind::SoundChunkAsset,
+    .id = id,
+    .renderer = nullptr,
+    .music_handle = MusicHandle(),
+    .sound_chunk_handle = sound_chunk_handle,
+    .texture_handle = TextureHandle(),
+    .decoded_chunk = nullptr,
+    .decoded_music = nullptr,
+    .decoded_surface = nullptr,
+    .decode_error = std::string(),
+    .decode_time = 0
+  });
+  this->in_flight_sound_chunks.emplace(id, sound_chunk_handle);
+
+  return sound_chunk_handle;
+};
+
+TextureHandle AssetLoader::requestTexture(
+  SDL_Renderer* renderer,
+  const std::string& id
+) {
+  TextureHandle texture_handle;
+  auto in_flight_entry = this->in_flight_textures.find(
+    TextureCacheKey(renderer, id)
+  );
+
+  if(in_flight_entry != this->in_flight_textures.end()) {
+    if(!in_flight_entry->second.failed())
+      return in_flight_entry->second;
+
+    this->in_flight_textures.erase(in_flight_entry);
+  }
+
+  texture_handle = TextureHandle(std::make_shared<AssetSlot<TextureRegion>>());
+
+  if(this->texture_cache.contains(renderer, id)) {
+    texture_handle.complete(this->texture_cache.acquire(renderer, id));
+    return texture_handle;
+  }
+
+  this->enqueueJob({
+    .kind = AssetKind::TextureAsset,
+    .id = id,
+    .renderer = renderer,
+    .music_handle = MusicHandle(),
+    .sound_chunk_handle = SoundChunkHandle(),
+    .texture_handle = texture_handle,
+    .decoded_chunk = nullptr,
+    .decoded_music = nullptr,
+    .decoded_surface = nullptr,
+    .decode_error = std::string(),
+    .decode_time = 0
+  });
+  this->in_flight_textures.emplace(
+    TextureCacheKey(renderer, id),
+    texture_handle
+  );
+
+  return texture_handle;
+};
+
+size_t AssetLoader::uploadDecodedAssets(double time_budget) noexcept {
+  AssetLoadJob job;
+  size_t completed_jobs = 0;
+  Uint64 start_counter = SDL_GetPerformanceCounter();
+  double elapsed_time;
+
+  // Jobs the workers failed on their own still count as completed.
+  this->completed_loads += this->failed_worker_jobs.exchange(0);
+
+  // At least one upload per call, so a tight budget still makes progress.
+  do {
+    if(!this->popDecodedJob(job))
+      break;
+
+    this->completeJob(job);
+    completed_jobs++;
+
+    elapsed_time = (double) (SDL_GetPerformanceCounter() - start_counter) / \
+      SDL_GetPerformanceFrequency();
+  } while(elapsed_time < time_budget);
+
+  return completed_jobs;
+};
+
+void AssetLoader::wait(const MusicHandle& music_handle) noexcept {
+  while(music_handle.isValid() && !music_handle.isDone())
+    if(this->uploadDecodedAssets(0) == 0)
+      this->waitForDecodedJobs();
+};
+
+void AssetLoader::wait(const SoundChunkHandle& sound_chunk_handle) noexcept {
+  while(sound_chunk_handle.isValid() && !sound_chunk_handle.isDone())
+    if(this->uploadDecodedAssets(0) == 0)
+      this->waitForDecodedJobs();
+};
+
+void AssetLoader::wait(const TextureHandle& texture_handle) noexcept {
+  while(texture_handle.isValid() && !texture_handle.isDone())
+    if(this->uploadDecodedAssets(0) == 0)
+      this->waitForDecodedJobs();
+};
+
+// Private method implementations.
+void AssetLoader::completeJob(AssetLoadJob& job) noexcept {
+  this->completed_loads++;
+
+  switch (job.kind) {
+    case AssetKind::MusicAsset:
+      this->completeMusicJob(job);
+      break;
+    case AssetKind::SoundChunkAsset:
+      this->completeSoundChunkJob(job);
+      break;
+    case AssetKind::TextureAsset:
+      this->completeTextureJob(job);
+      break;
+  }
+};
+
+void AssetLoader::completeMusicJob(AssetLoadJob& job) noexcept {
+  MixMusicSharedPTR music;
+
+  if(job.decoded_music == nullptr) {
+    std::cerr << "[AssetLoader] Failed to decode " << job.id << ": "
+      << job.decode_error << "\n";
+    job.music_handle.fail();
+    return;
+  }
+
+  try {
+    music = MixMusicSharedPTR(job.decoded_music, &Mix_FreeMusic);
+  }
+  catch(std::exception& e) {
+    job.decoded_music = nullptr;
+    job.music_handle.fail();
+    return;
+  }
+
+  job.decoded_music = nullptr;
+  job.music_handle.complete({.music = music, .decode_time = job.decode_time});
+};
+
+void AssetLoader::completeSoundChunkJob(AssetLoadJob& job) noexcept {
+  MixChunkSharedPTR chunk;
+
+  this->in_flight_sound_chunks.erase(job.id);
+
+  if(job.decoded_chunk == nullptr) {
+    std::cerr << "[AssetLoader] Failed to decode " << job.id << ": "
+      << job.decode_error << "\n";
+    job.sound_chunk_handle.fail();
+    return;
+  }
+
+  // The cache takes ownership of the decoded chunk.
+  chunk = this->sound_chunk_cache.acquire(job.id, job.decoded_chunk);
+  job.decoded_chunk = nullptr;
+
+  if(chunk)
+    job.sound_chunk_handle.complete(chunk);
+  else
+    job.sound_chunk_handle.fail();
+};
+
+void AssetLoader::completeTextureJob(AssetLoadJob& job) noexcept {
+  TextureRegion texture_region;
+
+  this->in_flight_textures.erase(TextureCacheKey(job.renderer, job.id));
+
+  if(job.decoded_surface == nullptr) {
+    std::cerr << "[AssetLoader] Failed to decode " << job.id << ": "
+      << job.decode_error << "\n";
+    job.texture_handle.fail();
+    return;
+  }
+
+  // The GPU upload is the only part of a load that needs the main thread.
+  texture_region = this->texture_cache.acquire(
+    job.renderer,
+    job.id,
+    job.decoded_surface
+  );
+  AssetLoader::freeDecodedData(job);
+
+  if(texture_region.texture)
+    job.texture_handle.complete(texture_region);
+  else
+    job.texture_handle.fail();
+};
+
+void AssetLoader::decodeJob(AssetLoadJob& job) const noexcept {
+  Uint64 decode_start_counter = SDL_GetPerformanceCounter();
+
+  // Packed assets are decoded straight from the archive mapping.
+  // Each loader takes ownership of its stream, even when decoding fails.
+  switch (job.kind) {
+    case AssetKind::MusicAsset:
+      job.decoded_music = Mix_LoadMUS_RW(
+        this->asset_archive.openAsset(job.id),
+        1
+      );
+      break;
+    case AssetKind::SoundChunkAsset:
+      job.decoded_chunk = Mix_LoadWAV_RW(
+        this->asset_archive.openAsset(job.id),
+        1
+      );
+      break;
+    case AssetKind::TextureAsset:
+      job.decoded_surface = TextureCache::loadSurface(
+        this->asset_archive,
+        job.id
+      );
+      break;
+  }
+
+  job.decode_time = (double) (
+    SDL_GetPerformanceCounter() - decode_start_counter
+  ) / SDL_GetPerformanceFrequency();
+
+  // SDL errors are per thread, so the main thread could not read this one.
+  if(
+    job.decoded_chunk == nullptr &&
+    job.decoded_music == nullptr &&
+    job.decoded_surface == nullptr
+  ) {
+    try {
+      job.decode_error = SDL_GetError();
+    }
+    catch(std::exception& e) {}
+  }
+};
+
+void AssetLoader::enqueueJob(AssetLoadJob job) {
+  {
+    std::lock_guard<std::mutex> jobs_lock(this->jobs_mutex);
+    this->pending_jobs.push_back(std::move(job));
+  }
+
+  this->requested_loads++;
+  this->pending_condition.notify_one();
+};
+
+void AssetLoader::failJob(AssetLoadJob& job) noexcept {
+  switch (job.kind) {
+    case AssetKind::MusicAsset:
+      job.music_handle.fail();
+      break;
+    case AssetKind::SoundChunkAsset:
+      job.sound_chunk_handle.fail();
+      break;
+    case AssetKind::TextureAsset:
+      job.texture_handle.fail();
+      break;
+  }
+};
+
+bool AssetLoader::popDecodedJob(AssetLoadJob& job) noexcept {
+  std::lock_guard<std::mutex> jobs_lock(this->jobs_mutex);
+
+  if(this->decoded_jobs.empty())
+    return false;
+
+  job = std::move(this->decoded_jobs.front());
+  this->decoded_jobs.pop_front();
+
+  return true;
+};
+
+void AssetLoader::runWorker() noexcept {
+  AssetLoadJob job;
+
+  while(true) {
+    {
+      std::unique_lock<std::mutex> jobs_lock(this->jobs_mutex);
+
+      this->pending_condition.wait(
+        jobs_lock,
+        [this] { return this->stop_requested || !this->pending_jobs.empty(); }
+      );
+
+      if(this->stop_requested)
+        return;
+
+      job = std::move(this->pending_jobs.front());
+      this->pending_jobs.pop_front();
+    }
+
+    // Decoding happens without the lock, so requests never wait on it.
+    this->decodeJob(job);
+
+    try {
+      std::lock_guard<std::mutex> jobs_lock(this->jobs_mutex);
+      this->decoded_jobs.push_back(std::move(job));
+    }
+    catch(std::exception& e) {
+      std::cerr << "[AssetLoader] " << e.what();
+      std::cerr << "[AssetLoader] Ignoring last exception and resuming "
+        "execution!\n";
+
+      // Failing is a plain store, so waiters and progress still see it end.
+      AssetLoader::freeDecodedData(job);
+      this->failJob(job);
+      this->failed_worker_jobs++;
+    }
+
+    this->decoded_condition.notify_all();
+  }
+};
+
+void AssetLoader::waitForDecodedJobs() noexcept {
+  std::unique_lock<std::mutex> jobs_lock(this->jobs_mutex);
+
+  this->decoded_condition.wait_for(
+    jobs_lock,
+    std::chrono::milliseconds(ASSET_LOADER_WAIT_SLICE_MS),
+    [this] { return !this->decoded_jobs.empty(); }
+  );
+};
+
+unsigned int AssetLoader::defaultWorkerCount() noexcept {
+  unsigned int hardware_threads = std::thread::hardware_concurrency();
+
+  // Leave a core to the main thread, which keeps rendering meanwhile.
+  if(hardware_threads <= 2)
+    return 1;
+
+  if(hardware_threads - 1 > ASSET_LOADER_MAX_WORKER_COUNT)
+    return ASSET_LOADER_MAX_WORKER_COUNT;
+
+  return hardware_threads - 1;
+};
+
+void AssetLoader::freeDecodedData(AssetLoadJob& job) noexcept {
+  if(job.decoded_surface != nullptr) {
+    SDL_FreeSurface(job.decoded_surface);
+    job.decoded_surface = nullptr;
+  }
+
+  if(job.decoded_chunk != nullptr) {
+    Mix_FreeChunk(job.decoded_chunk);
+    job.decoded_chunk = nullptr;
+  }
+
+  if(job.decoded_music != nullptr) {
+    Mix_FreeMusic(job.decoded_music);
+    job.decoded_music = nullptr;
+  }
+};
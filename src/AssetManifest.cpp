@@ -0,0 +1,148 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset Manifest class - Source code.
+
+// Class header include.
+#include "AssetManifest.hpp"
+
+// Class method implementations.
+AssetManifest::AssetManifest(const std::string& manifest_file) {
+  this->open(manifest_file);
+};
+
+// Public method implementations.
+void AssetManifest::addEntry(
+  AssetKind kind,
+  const std::string& id,
+  const std::string& file
+) {
+  if(this->entry_indices.count(id) != 0)
+    throw AssetManifestException(AssetManifestErrorCode::DuplicateAssetIdError);
+
+  this->entries.push_back({.kind = kind, .id = id, .file = file});
+  this->entry_indices.emplace(id, this->entries.size() - 1);
+};
+
+bool AssetManifest::contains(const std::string& id) const noexcept {
+  return this->entry_indices.count(id) != 0;
+};
+
+std::string AssetManifestErrorDescription::describeErrorCause(
+  AssetManifestErrorCode error_code
+) const noexcept {
+  std::string error_cause = std::string("This error was caused by ");
+
+  switch (error_code) {
+    case AssetManifestErrorCode::ReadAssetManifestError:
+      error_cause += "attempting to read the asset manifest from the file "
+        "system";
+      break;
+    case AssetManifestErrorCode::ParseAssetManifestError:
+      error_cause += "a malformed line in the asset manifest";
+      break;
+    case AssetManifestErrorCode::DuplicateAssetIdError:
+      error_cause += "an asset id listed more than once";
+      break;
+    case AssetManifestErrorCode::UnknownAssetIdError:
+      error_cause += "looking up an asset id missing from the manifest";
+      break;
+  }
+
+  error_cause += ".";
+
+  return error_cause;
+};
+
+std::string AssetManifestErrorDescription::describeErrorDetails(
+  AssetManifestErrorCode error_code
+) const noexcept {
+  std::string error_details;
+
+  switch (error_code) {
+    case AssetManifestErrorCode::ParseAssetManifestError:
+      error_details += "Each line must read \"<music|sound|texture> <id> "
+        "<file>\"";
+      break;
+    default:
+      error_details += "Check the asset manifest contents";
+      break;
+  }
+
+  error_details += ".";
+
+  return error_details;
+};
+
+std::string AssetManifestErrorDescription::describeErrorSummary() \
+const noexcept {
+  std::string error_summary = std::string(
+    "AssetManifestError: An error occurred when handling the asset manifest!"
+  );
+
+  return error_summary;
+};
+
+const std::vector<AssetManifestEntry>& AssetManifest::getEntries() \
+const noexcept {
+  return this->entries;
+};
+
+void AssetManifest::open(const std::string& manifest_file) {
+  std::ifstream manifest_stream(manifest_file);
+  std::string line, kind_name, id, file;
+  AssetKind kind;
+
+  if(!manifest_stream.is_open())
+    throw AssetManifestException(
+      AssetManifestErrorCode::ReadAssetManifestError
+    );
+
+  // Blank lines and lines starting with '#' are ignored.
+  while(std::getline(manifest_stream, line)) {
+    std::istringstream line_stream(line);
+
+    if(!(line_stream >> kind_name) || kind_name[0] == '#')
+      continue;
+
+    if(
+      !(line_stream >> id >> file) ||
+      AssetManifest::parseAssetKind(kind_name, kind) != 0
+    )
+      throw AssetManifestException(
+        AssetManifestErrorCode::ParseAssetManifestError
+      );
+
+    this->addEntry(kind, id, file);
+  }
+};
+
+const std::string& AssetManifest::pathOf(const std::string& id) const {
+  auto entry_index = this->entry_indices.find(id);
+
+  if(entry_index == this->entry_indices.end())
+    throw AssetManifestException(AssetManifestErrorCode::UnknownAssetIdError);
+
+  return this->entries[entry_index->second].file;
+};
+
+size_t AssetManifest::size() const noexcept {
+  return this->entries.size();
+};
+
+// Private method implementations.
+int AssetManifest::parseAssetKind(
+  const std::string& kind_name,
+  AssetKind& kind
+) noexcept {
+  if(kind_name == "music")
+    kind = AssetKind::MusicAsset;
+  else if(kind_name == "sound")
+    kind = AssetKind::SoundChunkAsset;
+  else if(kind_name == "texture")
+    kind = AssetKind::TextureAsset;
+  else
+    return -1;
+
+  return 0;
+};
@@ -0,0 +1,43 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Collider class - Source code.
+
+// Class header include.
+#include "Collider.hpp"
+
+// Class method implementations.
+Collider::Collider(
+  GameObject& associated,
+  unsigned int layer,
+  unsigned int mask
+) : Component(associated, ComponentType::ColliderComponent),
+  layer(layer),
+  mask(mask) {
+  this->attachToAssociatedGameObject();
+};
+
+// Public method implementations.
+bool Collider::acceptsCollisionWith(const Collider& other) const noexcept {
+  return (this->layer & other.mask) != 0 && (other.layer & this->mask) != 0;
+};
+
+unsigned int Collider::getLayer() const noexcept {
+  return this->layer;
+};
+
+unsigned int Collider::getMask() const noexcept {
+  return this->mask;
+};
+
+void Collider::render(SDL_Renderer* renderer) noexcept {};
+
+void Collider::setLayer(unsigned int layer) noexcept {
+  this->layer = layer;
+};
+
+void Collider::setMask(unsigned int mask) noexcept {
+  this->mask = mask;
+};
+
+void Collider::update(double dt) noexcept {};
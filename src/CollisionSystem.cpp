@@ -0,0 +1,249 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Collision System class - Source code.
+
+// Class header include.
+#include "CollisionSystem.hpp"
+
+// Public method implementations.
+void CollisionSystem::deliverCollisions() {
+  // Earlier callbacks may kill either object, so check before each one.
+  for(const CollisionPair& collision_pair : this->collision_pairs) {
+    if(collision_pair.first->isAlive() && collision_pair.second->isAlive())
+      collision_pair.first->notifyCollision(*collision_pair.second);
+
+    if(collision_pair.first->isAlive() && collision_pair.second->isAlive())
+      collision_pair.second->notifyCollision(*collision_pair.first);
+  }
+};
+
+size_t CollisionSystem::detectCollisions(
+  const std::vector<std::unique_ptr<GameObject>>& game_objects
+) {
+  this->collision_pairs.clear();
+  this->statistics = {};
+
+  this->gatherSweepEntries(game_objects);
+  this->bucketEntriesByBand();
+
+  for(size_t band = 0; band + 1 < this->band_starts.size(); band++)
+    this->sweepBand(band);
+
+  this->sortCollisionPairs();
+
+  this->statistics.colliders = this->sweep_entries.size();
+  this->statistics.collisions = this->collision_pairs.size();
+
+  return this->collision_pairs.size();
+};
+
+const std::vector<CollisionPair>& CollisionSystem::getCollisionPairs() \
+const noexcept {
+  return this->collision_pairs;
+};
+
+const CollisionStatistics& CollisionSystem::getStatistics() const noexcept {
+  return this->statistics;
+};
+
+void CollisionSystem::update(
+  const std::vector<std::unique_ptr<GameObject>>& game_objects
+) {
+  this->detectCollisions(game_objects);
+  this->deliverCollisions();
+};
+
+// Private method implementations.
+size_t CollisionSystem::bandOf(double cross_coordinate) const noexcept {
+  return (size_t) ((cross_coordinate - this->band_origin) / this->band_size);
+};
+
+void CollisionSystem::bucketEntriesByBand() {
+  size_t entry_count = this->sweep_entries.size(), band_count;
+  double cross_min, cross_max, cross_extent = 0;
+
+  this->band_entries.clear();
+  this->band_starts.assign(1, 0);
+
+  if(entry_count == 0)
+    return;
+
+  cross_min = this->sweep_entries[0].cross_min;
+  cross_max = this->sweep_entries[0].cross_max;
+
+  for(const SweepEntry& entry : this->sweep_entries) {
+    cross_min = std::min(cross_min, entry.cross_min);
+    cross_max = std::max(cross_max, entry.cross_max);
+    cross_extent += entry.cross_max - entry.cross_min;
+  }
+
+  // Bands a few boxes tall keep most boxes inside a single band, while
+  // there are never more bands than boxes.
+  this->band_origin = cross_min;
+  this->band_size = std::max(
+    COLLISION_SWEEP_BAND_EXTENT_FACTOR * cross_extent / entry_count,
+    (cross_max - cross_min) / entry_count
+  );
+
+  if(!(this->band_size > 0))
+    this->band_size = 1;
+
+  band_count = this->bandOf(cross_max) + 1;
+  this->band_starts.assign(band_count + 1, 0);
+
+  // Counting sort by band. Boxes crossing a border go into every band they
+  // touch, so each band can be swept on its own.
+  for(const SweepEntry& entry : this->sweep_entries)
+    for(
+      size_t band = this->bandOf(entry.cross_min);
+      band <= this->bandOf(entry.cross_max);
+      band++
+    )
+      this->band_starts[band + 1]++;
+
+  for(size_t band = 0; band < band_count; band++)
+    this->band_starts[band + 1] += this->band_starts[band];
+
+  this->band_entries.resize(this->band_starts.back());
+
+  // Each start serves as its band's cursor, ending up at the next start.
+  for(const SweepEntry& entry : this->sweep_entries)
+    for(
+      size_t band = this->bandOf(entry.cross_min);
+      band <= this->bandOf(entry.cross_max);
+      band++
+    )
+      this->band_entries[this->band_starts[band]++] = entry;
+
+  for(size_t band = band_count; band > 0; band--)
+    this->band_starts[band] = this->band_starts[band - 1];
+
+  this->band_starts[0] = 0;
+};
+
+void CollisionSystem::gatherSweepEntries(
+  const std::vector<std::unique_ptr<GameObject>>& game_objects
+) {
+  double sum_x = 0, sum_y = 0, sum_squared_x = 0, sum_squared_y = 0;
+  double center_x, center_y, count;
+
+  this->sweep_entries.clear();
+
+  for(const auto& game_object : game_objects) {
+    Collider* collider = game_object->getComponent<Collider>();
+    const Rectangle& box = game_object->box;
+
+    if(collider == nullptr || !game_object->isAlive())
+      continue;
+
+    this->sweep_entries.push_back({
+      .sweep_min = box.upper_left_corner.x,
+      .sweep_max = box.upper_left_corner.x + box.width,
+      .cross_min = box.upper_left_corner.y,
+      .cross_max = box.upper_left_corner.y + box.height,
+      .spawn_order = game_object->getSpawnOrder(),
+      .collider = collider
+    });
+
+    center_x = box.upper_left_corner.x + box.width / 2;
+    center_y = box.upper_left_corner.y + box.height / 2;
+    sum_x += center_x;
+    sum_y += center_y;
+    sum_squared_x += center_x * center_x;
+    sum_squared_y += center_y * center_y;
+  }
+
+  if(this->sweep_entries.empty())
+    return;
+
+  // Sweep along the axis where objects spread out most, so fewer overlap.
+  count = (double) this->sweep_entries.size();
+
+  if(
+    sum_squared_y - sum_y * sum_y / count >
+    sum_squared_x - sum_x * sum_x / count
+  )
+    for(SweepEntry& entry : this->sweep_entries) {
+      std::swap(entry.sweep_min, entry.cross_min);
+      std::swap(entry.sweep_max, entry.cross_max);
+    }
+};
+
+void CollisionSystem::sortCollisionPairs() {
+  auto delivered_earlier = [](
+    const CollisionPair& lhs,
+    const CollisionPair& rhs
+  ) noexcept {
+    if(lhs.first_spawn_order != rhs.first_spawn_order)
+      return lhs.first_spawn_order < rhs.first_spawn_order;
+
+    return lhs.second_spawn_order < rhs.second_spawn_order;
+  };
+
+  // The sweep finds pairs in coordinate order; spawn order is stable, and
+  // visits the objects in roughly the order they sit in memory.
+  std::sort(
+    this->collision_pairs.begin(),
+    this->collision_pairs.end(),
+    delivered_earlier
+  );
+};
+
+void CollisionSystem::sweepBand(size_t band) {
+  auto band_begin = this->band_entries.begin() + this->band_starts[band];
+  auto band_end = this->band_entries.begin() + this->band_starts[band + 1];
+
+  auto starts_earlier = [](
+    const SweepEntry& lhs,
+    const SweepEntry& rhs
+  ) noexcept {
+    return lhs.sweep_min < rhs.sweep_min;
+  };
+
+  std::sort(band_begin, band_end, starts_earlier);
+
+  for(auto entry = band_begin; entry != band_end; entry++) {
+    // Later entries start further along, so stop at the first one past us.
+    for(
+      auto other = entry + 1;
+      other != band_end && other->sweep_min < entry->sweep_max;
+      other++
+    ) {
+      this->statistics.broadphase_pairs++;
+
+      // Pairs sharing several bands count only where their overlap starts.
+      if(
+        !CollisionSystem::entriesOverlap(*entry, *other) ||
+        this->bandOf(std::max(entry->cross_min, other->cross_min)) != band ||
+        !entry->collider->acceptsCollisionWith(*other->collider)
+      )
+        continue;
+
+      const SweepEntry& first = \
+        entry->spawn_order < other->spawn_order ? *entry : *other;
+      const SweepEntry& second = &first == &*entry ? *other : *entry;
+
+      this->collision_pairs.push_back({
+        .first_spawn_order = first.spawn_order,
+        .second_spawn_order = second.spawn_order,
+        .first = &first.collider->getAssociated(),
+        .second = &second.collider->getAssociated()
+      });
+    }
+  }
+};
+
+// Same strict test as Rectangle::intersectsWith, so touching boxes do not
+// collide.
+bool CollisionSystem::entriesOverlap(
+  const SweepEntry& lhs,
+  const SweepEntry& rhs
+) noexcept {
+  return (
+    lhs.sweep_min < rhs.sweep_max &&
+    rhs.sweep_min < lhs.sweep_max &&
+    lhs.cross_min < rhs.cross_max &&
+    rhs.cross_min < lhs.cross_max
+  );
+};
@@ -0,0 +1,162 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Command Buffer class - Source code.
+
+// Class header include.
+#include "CommandBuffer.hpp"
+
+// Public method implementations.
+void CommandBuffer::addComponent(
+  GameObject& target,
+  GameObjectFactory factory
+) {
+  this->record({
+    .type = StructuralCommandType::AddComponentCommand,
+    .target = &target,
+    .component_type = ComponentType::ComponentTypeCount,
+    .factory = std::move(factory)
+  });
+};
+
+size_t CommandBuffer::countPendingCommands() const noexcept {
+  std::lock_guard<std::mutex> commands_lock(this->commands_mutex);
+  return this->commands.size();
+};
+
+void CommandBuffer::despawn(GameObject& target) {
+  this->record({
+    .type = StructuralCommandType::DespawnCommand,
+    .target = &target,
+    .component_type = ComponentType::ComponentTypeCount,
+    .state = GameObjectState::DeletionState,
+    .factory = nullptr
+  });
+};
+
+size_t CommandBuffer::flush(const GameObjectSpawner& spawner) noexcept {
+  this->last_flush_size = 0;
+
+  // Commands recorded while flushing, say by a factory, apply in this flush.
+  while(true) {
+    {
+      std::lock_guard<std::mutex> commands_lock(this->commands_mutex);
+      this->flushing_commands.swap(this->commands);
+    }
+
+    if(this->flushing_commands.empty())
+      return this->last_flush_size;
+
+    for(StructuralCommand& command : this->flushing_commands) {
+      try {
+        this->applyCommand(command, spawner);
+      }
+      catch(std::exception& e) {
+        std::cerr << "[CommandBuffer] " << e.what();
+        std::cerr << "[CommandBuffer] Ignoring last exception and resuming "
+          "execution!\n";
+      }
+
+      this->last_flush_size++;
+    }
+
+    // Cleared but not shrunk, so steady frames reuse both buffers.
+    this->flushing_commands.clear();
+  }
+};
+
+size_t CommandBuffer::getLastFlushSize() const noexcept {
+  return this->last_flush_size;
+};
+
+void CommandBuffer::removeComponent(
+  GameObject& target,
+  ComponentType component_type
+) {
+  this->record({
+    .type = StructuralCommandType::RemoveComponentCommand,
+    .target = &target,
+    .component_type = component_type,
+    .factory = nullptr
+  });
+};
+
+void CommandBuffer::spawn(GameObjectFactory factory) {
+  this->record({
+    .type = StructuralCommandType::SpawnCommand,
+    .target = nullptr,
+    .component_type = ComponentType::ComponentTypeCount,
+    .factory = std::move(factory)
+  });
+};
+
+void CommandBuffer::transitionState(
+  GameObject& target,
+  GameObjectState state
+) {
+  this->record({
+    .type = StructuralCommandType::TransitionStateCommand,
+    .target = &target,
+    .component_type = ComponentType::ComponentTypeCount,
+    .state = state,
+    .factory = nullptr
+  });
+};
+
+// Private method implementations.
+void CommandBuffer::applyCommand(
+  StructuralCommand& command,
+  const GameObjectSpawner& spawner
+) {
+  GameObject* spawned_game_object;
+
+  switch (command.type) {
+    case StructuralCommandType::AddComponentCommand:
+      command.factory(*command.target);
+      break;
+
+    case StructuralCommandType::DespawnCommand:
+    case StructuralCommandType::TransitionStateCommand:
+      CommandBuffer::applyStateTransition(*command.target, command.state);
+      break;
+
+    case StructuralCommandType::RemoveComponentCommand:
+      command.target->removeComponent(command.component_type);
+      break;
+
+    // The spawner adopts the object first, so its components register.
+    case StructuralCommandType::SpawnCommand:
+      spawned_game_object = new GameObject();
+      spawner(spawned_game_object);
+      command.factory(*spawned_game_object);
+      break;
+  }
+};
+
+void CommandBuffer::record(StructuralCommand command) {
+  std::lock_guard<std::mutex> commands_lock(this->commands_mutex);
+  this->commands.push_back(std::move(command));
+};
+
+void CommandBuffer::applyStateTransition(
+  GameObject& target,
+  GameObjectState state
+) {
+  // A repeated transition in the same step is a no-op, not a second death.
+  if(target.getState() == state)
+    return;
+
+  switch (state) {
+    case GameObjectState::DeadState:
+      target.resolveDeath();
+      break;
+
+    case GameObjectState::DeletionState:
+      target.requestDeletion();
+      break;
+
+    // Nothing revives objects yet, so there is nothing to apply.
+    case GameObjectState::AliveState:
+      break;
+  }
+};
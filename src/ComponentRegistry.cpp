@@ -0,0 +1,234 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Component Registry class - Source code.
+
+// Class header include.
+#include "ComponentRegistry.hpp"
+
+// User includes.
+#include "Collider.hpp"
+#include "Face.hpp"
+#include "Sound.hpp"
+#include "Sprite.hpp"
+
+// Public method implementations.
+size_t ComponentRegistry::countComponentsOfType(
+  ComponentType type
+) const noexcept {
+  return this->pools[type].size() - this->vacant_entries[type];
+};
+
+void ComponentRegistry::registerComponent(Component* component) {
+  ComponentType type = component->getType();
+  std::vector<RegisteredComponent>& pool = this->pools[type];
+  RegisteredComponent new_entry = {
+    .spawn_order = component->getAssociated().getSpawnOrder(),
+    .component = component
+  };
+
+  auto spawned_earlier = [](
+    const RegisteredComponent& lhs,
+    const RegisteredComponent& rhs
+  ) noexcept {
+    return lhs.spawn_order < rhs.spawn_order;
+  };
+
+  // Pools stay in depth order. New objects are the newest, so this appends.
+  auto insert_position = upper_bound(
+    pool.begin(),
+    pool.end(),
+    new_entry,
+    spawned_earlier
+  );
+  size_t new_entry_index = insert_position - pool.begin();
+
+  pool.insert(insert_position, new_entry);
+  this->renumberPoolFrom(type, new_entry_index);
+};
+
+void ComponentRegistry::renderComponents(
+  SDL_Renderer* renderer,
+  SpriteBatch& sprite_batch,
+  double interpolation_factor,
+  unsigned long visibility_frame
+) {
+  std::array<size_t, ComponentTypeCount> next_entries = {};
+  RegisteredComponent* next_entry;
+  size_t next_type = ComponentTypeCount;
+
+  this->compactPools();
+  sprite_batch.begin(renderer);
+
+  // Merge the pools that draw anything, so depth order holds across types.
+  while(true) {
+    next_entry = nullptr;
+
+    for(size_t type = 0; type < ComponentTypeCount; type++) {
+      if(
+        !ComponentRegistry::typeHasRenderWork((ComponentType) type) ||
+        next_entries[type] == this->pools[type].size()
+      )
+        continue;
+
+      RegisteredComponent& candidate = this->pools[type][next_entries[type]];
+
+      if(
+        next_entry == nullptr ||
+        candidate.spawn_order < next_entry->spawn_order
+      ) {
+        next_entry = &candidate;
+        next_type = type;
+      }
+    }
+
+    if(next_entry == nullptr)
+      break;
+
+    next_entries[next_type]++;
+
+    GameObject& owner = next_entry->component->getAssociated();
+
+    // Owners outside the viewport were culled by the visibility pass.
+    if(!owner.isVisibleInFrame(visibility_frame))
+      continue;
+
+    owner.updateRenderBox(interpolation_factor);
+
+    // Sprites are batched; anything else draws itself after the batch so far.
+    if(next_type == ComponentType::SpriteComponent)
+      static_cast<Sprite*>(next_entry->component)->appendToBatch(sprite_batch);
+
+    else {
+      sprite_batch.flush();
+      next_entry->component->render(renderer);
+    }
+  }
+
+  sprite_batch.end();
+};
+
+bool ComponentRegistry::typeHasRenderWork(ComponentType type) noexcept {
+  switch (type) {
+    case ComponentType::ColliderComponent:
+      return Collider::has_render_work;
+    case ComponentType::FaceComponent:
+      return Face::has_render_work;
+    case ComponentType::SoundComponent:
+      return Sound::has_render_work;
+    case ComponentType::SpriteComponent:
+      return Sprite::has_render_work;
+    default:
+      return true;
+  }
+};
+
+bool ComponentRegistry::typeHasParallelUpdateWork(
+  ComponentType type
+) noexcept {
+  return (
+    ComponentRegistry::typeHasUpdateWork(type) &&
+    !ComponentRegistry::typeUpdatesSharedState(type)
+  );
+};
+
+bool ComponentRegistry::typeHasSerialUpdateWork(ComponentType type) noexcept {
+  return (
+    ComponentRegistry::typeHasUpdateWork(type) &&
+    ComponentRegistry::typeUpdatesSharedState(type)
+  );
+};
+
+bool ComponentRegistry::typeHasUpdateWork(ComponentType type) noexcept {
+  switch (type) {
+    case ComponentType::ColliderComponent:
+      return Collider::has_update_work;
+    case ComponentType::FaceComponent:
+      return Face::has_update_work;
+    case ComponentType::SoundComponent:
+      return Sound::has_update_work;
+    case ComponentType::SpriteComponent:
+      return Sprite::has_update_work;
+    default:
+      return true;
+  }
+};
+
+bool ComponentRegistry::typeUpdatesSharedState(ComponentType type) noexcept {
+  // Moving an object counts, the spatial grid is shared. Unknown types do too.
+  switch (type) {
+    case ComponentType::ColliderComponent:
+      return Collider::updates_shared_state;
+    case ComponentType::FaceComponent:
+      return Face::updates_shared_state;
+    case ComponentType::SoundComponent:
+      return Sound::updates_shared_state;
+    case ComponentType::SpriteComponent:
+      return Sprite::updates_shared_state;
+    default:
+      return true;
+  }
+};
+
+void ComponentRegistry::unregisterComponent(Component* component) noexcept {
+  ComponentType type = component->getType();
+  size_t entry_index = component->getRegistryEntry();
+
+  if(
+    entry_index >= this->pools[type].size() ||
+    this->pools[type][entry_index].component != component
+  )
+    return;
+
+  // Leave a hole so removals stay O(1); holes are compacted before passes.
+  this->pools[type][entry_index].component = nullptr;
+  this->vacant_entries[type]++;
+};
+
+void ComponentRegistry::updateComponents(double dt) {
+  this->compactPools();
+
+  // The rest already updated with their objects in the parallel phase.
+  for(size_t type = 0; type < ComponentTypeCount; type++) {
+    if(!ComponentRegistry::typeHasSerialUpdateWork((ComponentType) type))
+      continue;
+
+    // Index loop, since updates may register new components.
+    for(size_t entry = 0; entry < this->pools[type].size(); entry++)
+      if(this->pools[type][entry].component != nullptr)
+        this->pools[type][entry].component->update(dt);
+  }
+};
+
+// Private method implementations.
+void ComponentRegistry::compactPool(ComponentType type) noexcept {
+  std::vector<RegisteredComponent>& pool = this->pools[type];
+
+  auto entry_is_vacant = [](const RegisteredComponent& entry) noexcept {
+    return entry.component == nullptr;
+  };
+
+  pool.erase(
+    remove_if(pool.begin(), pool.end(), entry_is_vacant),
+    pool.end()
+  );
+  this->vacant_entries[type] = 0;
+  this->renumberPoolFrom(type, 0);
+};
+
+void ComponentRegistry::compactPools() noexcept {
+  for(size_t type = 0; type < ComponentTypeCount; type++)
+    if(this->vacant_entries[type] != 0)
+      this->compactPool((ComponentType) type);
+};
+
+void ComponentRegistry::renumberPoolFrom(
+  ComponentType type,
+  size_t first_entry
+) noexcept {
+  std::vector<RegisteredComponent>& pool = this->pools[type];
+
+  for(size_t entry = first_entry; entry < pool.size(); entry++)
+    if(pool[entry].component != nullptr)
+      pool[entry].component->setRegistryEntry(entry);
+};
@@ -15,9 +15,12 @@ Face::Face(
 
 // Public method implementations.
 void Face::registerDamage(unsigned int damage) {
+  bool was_dead = this->isDead();
+
   this->subtractDamageFromHitpoints(damage);
 
-  if(this->isDead())
+  // Death is deferred, so later hits in the same step must not die again.
+  if(!was_dead && this->isDead())
     this->handleAssociatedGameObjectDeath();
 };
 
@@ -27,8 +30,20 @@ void Face::update(double dt) noexcept {};
 
 // Private method implementations.
 void Face::handleAssociatedGameObjectDeath() {
+  CommandBuffer* command_buffer = this->associated.getCommandBuffer();
+
+  // Picking skips the object from here on, even before the flush kills it.
+  this->associated.recordDeath();
   this->playAssociatedGameObjectDeathSound();
-  this->associated.resolveDeath();
+
+  // Removing components now would pull them from under the current loop.
+  if(command_buffer != nullptr)
+    command_buffer->transitionState(
+      this->associated,
+      GameObjectState::DeadState
+    );
+  else
+    this->associated.resolveDeath();
 };
 
 bool Face::isDead() const noexcept {
@@ -36,11 +51,8 @@ bool Face::isDead() const noexcept {
 };
 
 void Face::playAssociatedGameObjectDeathSound() noexcept {
-  Sound* associated_sound_component;
-
-  associated_sound_component = static_cast<Sound*>(
-    this->associated.getComponent(ComponentType::SoundComponent)
-  );
+  Sound* associated_sound_component = \
+    this->associated.getComponent<Sound>();
 
   if(associated_sound_component != nullptr) {    
     try {
@@ -0,0 +1,169 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Frame Pacer class - Source code.
+
+// Class header include.
+#include "FramePacer.hpp"
+
+// Class method implementations.
+FramePacer::FramePacer(
+  double frame_rate,
+  PresentStrategy present_strategy
+) noexcept :
+  frame_rate(frame_rate),
+  performance_frequency(SDL_GetPerformanceFrequency()),
+  present_strategy(present_strategy) {};
+
+// Public method implementations.
+void FramePacer::beginFrame() noexcept {
+  Uint64 current_counter = SDL_GetPerformanceCounter();
+  Uint64 latch_lead_counter;
+
+  if(
+    this->present_strategy == PresentStrategy::LateLatchPresent &&
+    this->isFrameRateCapped()
+  ) {
+    // A frame that ran late starts a fresh schedule instead of catching up.
+    if(
+      this->next_deadline_counter == 0 ||
+      current_counter > this->next_deadline_counter
+    )
+      this->next_deadline_counter = current_counter + \
+        this->frameBudgetCounter();
+
+    // Input is sampled as late as the predicted work still allows.
+    latch_lead_counter = (Uint64) (
+      (this->predicted_work_time + FRAME_PACER_LATE_LATCH_MARGIN) * \
+      this->performance_frequency
+    );
+
+    if(this->next_deadline_counter > current_counter + latch_lead_counter)
+      this->sleepUntil(this->next_deadline_counter - latch_lead_counter);
+  }
+
+  this->frame_start_counter = SDL_GetPerformanceCounter();
+};
+
+void FramePacer::endFrame() noexcept {
+  Uint64 frame_end_counter = SDL_GetPerformanceCounter();
+  double work_time = (double) (
+    frame_end_counter - this->frame_start_counter
+  ) / this->performance_frequency;
+
+  // Smoothed, so a single slow frame does not push the latch point back.
+  this->predicted_work_time += FRAME_PACER_WORK_TIME_SMOOTHING * (
+    work_time - this->predicted_work_time
+  );
+
+  if(!this->isFrameRateCapped())
+    return;
+
+  switch (this->present_strategy) {
+    case PresentStrategy::SleepAfterPresent:
+      this->sleepUntil(this->frame_start_counter + this->frameBudgetCounter());
+      break;
+
+    case PresentStrategy::LateLatchPresent:
+      this->next_deadline_counter += this->frameBudgetCounter();
+      break;
+
+    // The present itself blocks until the display is ready for a frame.
+    case PresentStrategy::VSyncPresent:
+    case PresentStrategy::UncappedPresent:
+      break;
+  }
+};
+
+double FramePacer::getFrameRate() const noexcept {
+  return this->frame_rate;
+};
+
+double FramePacer::getPredictedWorkTime() const noexcept {
+  return this->predicted_work_time;
+};
+
+PresentStrategy FramePacer::getPresentStrategy() const noexcept {
+  return this->present_strategy;
+};
+
+void FramePacer::setFrameRate(double frame_rate) noexcept {
+  this->frame_rate = frame_rate;
+  this->next_deadline_counter = 0;
+};
+
+void FramePacer::setPresentStrategy(
+  PresentStrategy present_strategy
+) noexcept {
+  this->present_strategy = present_strategy;
+  this->next_deadline_counter = 0;
+};
+
+int FramePacer::parsePresentStrategy(
+  const std::string& name,
+  PresentStrategy& present_strategy
+) noexcept {
+  if(name == "sleep")
+    present_strategy = PresentStrategy::SleepAfterPresent;
+  else if(name == "vsync")
+    present_strategy = PresentStrategy::VSyncPresent;
+  else if(name == "late-latch")
+    present_strategy = PresentStrategy::LateLatchPresent;
+  else if(name == "uncapped")
+    present_strategy = PresentStrategy::UncappedPresent;
+  else
+    return -1;
+
+  return 0;
+};
+
+const char* FramePacer::presentStrategyName(
+  PresentStrategy present_strategy
+) noexcept {
+  switch (present_strategy) {
+    case PresentStrategy::SleepAfterPresent:
+      return "sleep";
+    case PresentStrategy::VSyncPresent:
+      return "vsync";
+    case PresentStrategy::LateLatchPresent:
+      return "late-latch";
+    case PresentStrategy::UncappedPresent:
+      return "uncapped";
+  }
+
+  return "unknown";
+};
+
+// Private method implementations.
+Uint64 FramePacer::frameBudgetCounter() const noexcept {
+  return (Uint64) (this->performance_frequency / this->frame_rate);
+};
+
+bool FramePacer::isFrameRateCapped() const noexcept {
+  return (
+    this->frame_rate > 0 &&
+    this->present_strategy != PresentStrategy::UncappedPresent
+  );
+};
+
+void FramePacer::sleepUntil(Uint64 wake_counter) const noexcept {
+  double remaining_time;
+
+  // SDL_Delay oversleeps by up to a millisecond, so the tail is spun out.
+  while(true) {
+    Uint64 current_counter = SDL_GetPerformanceCounter();
+
+    if(current_counter >= wake_counter)
+      return;
+
+    remaining_time = (double) (wake_counter - current_counter) / \
+      this->performance_frequency;
+
+    if(remaining_time > FRAME_PACER_SPIN_THRESHOLD)
+      SDL_Delay(
+        (Uint32) ((remaining_time - FRAME_PACER_SPIN_THRESHOLD) * 1000)
+      );
+    else
+      std::this_thread::yield();
+  }
+};
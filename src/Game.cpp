@@ -10,9 +10,19 @@
 Game* Game::instance = nullptr; 
 
 // Class method implementations.
-Game::Game(GameParams game_params) {
+Game::Game(GameParams game_params) :
+  frame_pacer(
+    game_params.loop_params.frame_rate,
+    game_params.loop_params.present_strategy
+  ),
+  launch_counter(SDL_GetPerformanceCounter()),
+  loop_params(game_params.loop_params),
+  performance_frequency(SDL_GetPerformanceFrequency())
+{
   SDLConfig game_SDL_config = this->defaultSDLConfig(game_params);
 
+  Profiler::setFrameBudget(1.0 / this->loop_params.frame_rate);
+
   try {
     this->initGame(game_SDL_config);
   }
@@ -30,13 +40,25 @@ Game::~Game() noexcept {
 };
 
 // Public method implementations.
-Game& Game::getInstance() {
-  GameParams game_params = {
+GameParams Game::defaultGameParams() noexcept {
+  return {
     .title = GAME_WINDOW_TITLE,
     .width = GAME_WINDOW_WIDTH,
-    .height = GAME_WINDOW_HEIGHT
+    .height = GAME_WINDOW_HEIGHT,
+    .loop_params = {
+      .simulation_rate = GAME_SIMULATION_RATE,
+      .frame_rate = GAME_FRAME_RATE,
+      .present_strategy = PresentStrategy::SleepAfterPresent
+    },
+    .headless = false
   };
+};
 
+Game& Game::getInstance() {
+  return Game::getInstance(Game::defaultGameParams());
+};
+
+Game& Game::getInstance(GameParams game_params) {
   if(Game::instance == nullptr)
     Game::instance = new Game(game_params);
 
@@ -51,14 +73,83 @@ State& Game::getState() noexcept {
   return *(this->state);
 };
 
+const FramePacer& Game::getFramePacer() const noexcept {
+  return this->frame_pacer;
+};
+
+JobSystem& Game::getJobSystem() noexcept {
+  return this->job_system;
+};
+
+double Game::getTimeToFirstFrame() const noexcept {
+  return this->time_to_first_frame;
+};
+
 void Game::run() {
+  double accumulated_time = 0, simulation_dt = this->simulationTimeStep();
+  Uint64 frame_start_counter, last_frame_start_counter;
+
+  last_frame_start_counter = SDL_GetPerformanceCounter();
+
   while (this->shouldKeepRunning()) {
-    this->updateGameState();
-    this->renderAndPresentGameState();
-    this->waitTimeIntervalBetweenFrames();
+    PROFILE_FRAME();
+
+    // Late latching sleeps here, so the steps below sample fresher input.
+    this->frame_pacer.beginFrame();
+    frame_start_counter = SDL_GetPerformanceCounter();
+    accumulated_time += this->clampedFrameDuration(
+      this->secondsElapsedBetween(last_frame_start_counter, frame_start_counter)
+    );
+    last_frame_start_counter = frame_start_counter;
+
+    // Consume the elapsed time in fixed steps, carrying the remainder over.
+    while (accumulated_time >= simulation_dt && this->shouldKeepRunning()) {
+      this->updateGameState(simulation_dt);
+      accumulated_time -= simulation_dt;
+    }
+
+    this->renderAndPresentGameState(accumulated_time / simulation_dt);
+
+    if(!this->first_frame_presented)
+      this->recordTimeToFirstFrame();
+
+    this->frame_pacer.endFrame();
   }
 };
 
+void Game::setPresentStrategy(PresentStrategy present_strategy) noexcept {
+  bool renderer_created = this->renderer != nullptr && this->window != nullptr;
+  int vsync_status = 0;
+
+// Older SDL versions only take vsync at renderer creation.
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  if(renderer_created)
+    vsync_status = SDL_RenderSetVSync(
+      this->renderer,
+      present_strategy == PresentStrategy::VSyncPresent ? 1 : 0
+    );
+#else
+  if(renderer_created && present_strategy == PresentStrategy::VSyncPresent)
+    vsync_status = -1;
+#endif
+
+  // Presents would otherwise run uncapped, so sleeping keeps the frame rate.
+  if(vsync_status != 0 && present_strategy == PresentStrategy::VSyncPresent) {
+    std::cerr << "[Game] VSync cannot be enabled on a running renderer, "
+      "sleeping after present instead!\n";
+    present_strategy = PresentStrategy::SleepAfterPresent;
+  }
+
+  this->loop_params.present_strategy = present_strategy;
+  this->frame_pacer.setPresentStrategy(present_strategy);
+};
+
+void Game::setTargetFrameRate(double frame_rate) noexcept {
+  this->loop_params.frame_rate = frame_rate;
+  this->frame_pacer.setFrameRate(frame_rate);
+  Profiler::setFrameBudget(1.0 / frame_rate);
+};
+
 std::string GameInitErrorDescription::describeErrorCause(
   GameInitErrorCode error_code
 ) const noexcept {
@@ -206,6 +297,11 @@ void Game::cleanUpGameRenderer() noexcept {
     SDL_DestroyRenderer(this->renderer);
     this->renderer = nullptr;
   }
+
+  if(this->render_target != nullptr) {
+    SDL_FreeSurface(this->render_target);
+    this->render_target = nullptr;
+  }
 };
 
 void Game::cleanUpGameState() noexcept {
@@ -229,8 +325,16 @@ void Game::cleanUpSDLModules() noexcept {
   SDL_Quit();
 };
 
+double Game::clampedFrameDuration(double frame_duration) const noexcept {
+  // Avoid a spiral of catch-up updates after a long stall (e.g. a breakpoint).
+  return frame_duration > GAME_MAX_FRAME_DURATION ?
+    GAME_MAX_FRAME_DURATION :
+    frame_duration;
+};
+
 SDLConfig Game::defaultSDLConfig(GameParams game_params) const noexcept {
   return {
+    .headless = game_params.headless,
     .SDL_flags =  SDL_INIT_AUDIO | SDL_INIT_TIMER | SDL_INIT_VIDEO,
     .image_flags = IMG_INIT_JPG | IMG_INIT_PNG,
     .mixer_flags = MIX_INIT_OGG,
@@ -251,7 +355,12 @@ SDLConfig Game::defaultSDLConfig(GameParams game_params) const noexcept {
     },
     .renderer_params = {
       .index = -1,
-      .flags = SDL_RENDERER_ACCELERATED
+      .flags = (Uint32) (
+        game_params.loop_params.present_strategy == \
+          PresentStrategy::VSyncPresent ?
+        SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC :
+        SDL_RENDERER_ACCELERATED
+      )
     },
   };
 };
@@ -260,6 +369,9 @@ void Game::initGame(SDLConfig SDL_config) {
   if(this->verifySingletonProperty() != 0)
     throw GameInitException(GameInitErrorCode::DuplicateGameInstanceError);
 
+  if(SDL_config.headless && this->initSDLHeadlessDrivers() != 0)
+    throw GameInitException(GameInitErrorCode::SDLError);
+
   if(this->initSDL(SDL_config.SDL_flags) != 0)
     throw GameInitException(GameInitErrorCode::SDLError);
 
@@ -274,11 +386,19 @@ void Game::initGame(SDLConfig SDL_config) {
   )
     throw GameInitException(GameInitErrorCode::SDLAudioError);
 
-  if(this->initSDLWindow(SDL_config.window_params) != 0)
-    throw GameInitException(GameInitErrorCode::SDLWindowError);
+  // Headless games draw into an off-screen surface instead of a window.
+  if(SDL_config.headless) {
+    if(this->initSDLHeadlessRenderer(SDL_config.window_params) != 0)
+      throw GameInitException(GameInitErrorCode::SDLRendererError);
+  }
 
-  if(this->initSDLRenderer(SDL_config.renderer_params) != 0)
-    throw GameInitException(GameInitErrorCode::SDLRendererError);
+  else {
+    if(this->initSDLWindow(SDL_config.window_params) != 0)
+      throw GameInitException(GameInitErrorCode::SDLWindowError);
+
+    if(this->initSDLRenderer(SDL_config.renderer_params) != 0)
+      throw GameInitException(GameInitErrorCode::SDLRendererError);
+  }
 
   if(this->initGameState() != 0)
     throw GameInitException(GameInitErrorCode::GameStateError);
@@ -288,7 +408,7 @@ void Game::initGame(SDLConfig SDL_config) {
 
 int Game::initGameState() noexcept {
   try {
-    this->state = new State(this->renderer);
+    this->state = new State(this->renderer, this->job_system);
   }
   catch(std::exception& e) {
     std::cerr << "[Game] " << e.what();
@@ -328,6 +448,40 @@ int Game::initSDLAudio(
     return -1;
 };
 
+int Game::initSDLHeadlessDrivers() noexcept {
+  // The drivers are picked up by SDL_Init, so they must be set before it.
+  if(
+    SDL_setenv("SDL_VIDEODRIVER", GAME_HEADLESS_VIDEO_DRIVER, 1) == 0 &&
+    SDL_setenv("SDL_AUDIODRIVER", GAME_HEADLESS_AUDIO_DRIVER, 1) == 0
+  )
+    return 0;
+  else
+    return -1;
+};
+
+int Game::initSDLHeadlessRenderer(SDLWindowParams window_params) noexcept {
+  this->render_target = SDL_CreateRGBSurfaceWithFormat(
+    0,
+    window_params.width,
+    window_params.height,
+    32,
+    GAME_HEADLESS_PIXEL_FORMAT
+  );
+
+  if(this->render_target == nullptr)
+    return -1;
+
+  this->renderer = SDL_CreateSoftwareRenderer(this->render_target);
+
+  if(this->renderer != nullptr)
+    return 0;
+
+  SDL_FreeSurface(this->render_target);
+  this->render_target = nullptr;
+
+  return -1;
+};
+
 int Game::initSDLImage(int image_flags) noexcept {
   if(IMG_Init(image_flags) == image_flags)
     return 0;
@@ -371,9 +525,25 @@ int Game::initSDLWindow(SDLWindowParams window_params) noexcept {
     return -1;
 };
 
-void Game::renderAndPresentGameState() {
+void Game::recordTimeToFirstFrame() noexcept {
+  this->first_frame_presented = true;
+  this->time_to_first_frame = this->secondsElapsedBetween(
+    this->launch_counter,
+    SDL_GetPerformanceCounter()
+  );
+
+// Read through getTimeToFirstFrame otherwise, so release runs stay quiet.
+#ifdef ENABLE_PROFILING
+  std::cout << "[Game] Time to first frame: "
+    << 1000 * this->time_to_first_frame << " ms.\n";
+#endif
+};
+
+void Game::renderAndPresentGameState(double interpolation_factor) {
+  PROFILE_SCOPE("Game::renderAndPresentGameState");
+
   try {
-    this->state->renderAndPresent();
+    this->state->renderAndPresent(interpolation_factor);
   }
   catch(std::exception& e) {
     std::cerr << "[Game] " << e.what();
@@ -381,13 +551,26 @@ void Game::renderAndPresentGameState() {
   }
 };
 
+double Game::secondsElapsedBetween(
+  Uint64 start_counter,
+  Uint64 end_counter
+) const noexcept {
+  return (double) (end_counter - start_counter) / this->performance_frequency;
+};
+
 bool Game::shouldKeepRunning() const noexcept {
   return !(this->state->quitRequested());
 };
 
-void Game::updateGameState() {
+double Game::simulationTimeStep() const noexcept {
+  return 1.0 / this->loop_params.simulation_rate;
+};
+
+void Game::updateGameState(double dt) {
+  PROFILE_SCOPE("Game::updateGameState");
+
   try {
-    this->state->update(0);
+    this->state->update(dt);
   }
   catch(std::exception& e) {
     std::cerr << "[Game] " << e.what();
@@ -401,7 +584,3 @@ int Game::verifySingletonProperty() const noexcept {
   else
     return -1;
 };
-
-void Game::waitTimeIntervalBetweenFrames() const noexcept {
-  SDL_Delay(33);
-};
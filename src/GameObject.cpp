@@ -6,34 +6,126 @@
 // Class header include.
 #include "GameObject.hpp"
 
+// User includes.
+#include "ComponentRegistry.hpp"
+
 // Class method implementations.
 Component::Component(GameObject& associated, ComponentType type) noexcept :
   associated(associated),
   type(type) {};
 
+GameObject::GameObject() {
+  // Room for one component of each type, so spawning never regrows it.
+  this->components.reserve(ComponentTypeCount);
+};
+
+GameObject::~GameObject() noexcept {
+  if(this->component_registry != nullptr)
+    for(auto& component : this->components)
+      this->component_registry->unregisterComponent(component.get());
+
+  if(this->spatial_index != nullptr)
+    this->spatial_index->remove(this);
+};
+
 // Public method implementations.
 void Component::attachToAssociatedGameObject() {
   associated.addComponent(this);
 };
 
+GameObject& Component::getAssociated() const noexcept {
+  return this->associated;
+};
+
+size_t Component::getRegistryEntry() const noexcept {
+  return this->registry_entry;
+};
+
+ComponentType Component::getType() const noexcept {
+  return this->type;
+};
+
 bool Component::is(ComponentType type) const noexcept {
   return this->type == type;
 };
 
+// Most components ignore collisions, so the default does nothing.
+void Component::notifyCollision(GameObject& other) {};
+
+void Component::setRegistryEntry(size_t registry_entry) noexcept {
+  this->registry_entry = registry_entry;
+};
+
+// Parallel updates may only touch their own object, or defer to the queue.
+void Component::updateInParallel(double dt, JobSystem& job_system) {};
+
 void GameObject::addComponent(Component* new_component) {
+  ComponentType new_component_type = new_component->getType();
+
   this->components.emplace_back(std::unique_ptr<Component>(new_component));
+
+  // The slot keeps the first component of each type, as searches used to.
+  if(this->component_slots[new_component_type] == nullptr) {
+    this->component_slots[new_component_type] = new_component;
+    this->component_mask |= GameObject::componentTypeBit(new_component_type);
+  }
+
+  if(this->component_registry != nullptr)
+    this->component_registry->registerComponent(new_component);
+};
+
+void GameObject::attachToCommandBuffer(
+  CommandBuffer* command_buffer
+) noexcept {
+  this->command_buffer = command_buffer;
+};
+
+void GameObject::attachToComponentRegistry(
+  ComponentRegistry* component_registry
+) {
+  if(this->component_registry != nullptr)
+    for(auto& component : this->components)
+      this->component_registry->unregisterComponent(component.get());
+
+  this->component_registry = component_registry;
+
+  if(this->component_registry != nullptr)
+    for(auto& component : this->components)
+      this->component_registry->registerComponent(component.get());
+};
+
+void GameObject::attachToSpatialIndex(SpatialGrid* spatial_index) {
+  if(this->spatial_index != nullptr)
+    this->spatial_index->remove(this);
+
+  this->spatial_index = spatial_index;
+
+  if(this->spatial_index != nullptr)
+    this->spatial_index->insert(this);
+};
+
+bool GameObject::deathWasRecorded() const noexcept {
+  return this->death_recorded;
 };
 
 bool GameObject::deletionWasRequested() const noexcept {
   return this->state == GameObjectState::DeletionState;
 };
 
+CommandBuffer* GameObject::getCommandBuffer() const noexcept {
+  return this->command_buffer;
+};
+
 Component* GameObject::getComponent(ComponentType type) noexcept {
-  component_const_iter result = this->searchComponentsByType(type);
+  return this->component_slots[type];
+};
+
+const Rectangle& GameObject::getRenderBox() const noexcept {
+  return this->render_box;
+};
 
-  return result != this->components.end() ?
-    result->get() :
-    nullptr;
+unsigned long GameObject::getSpawnOrder() const noexcept {
+  return this->spawn_order;
 };
 
 GameObjectState GameObject::getState() const noexcept {
@@ -41,13 +133,32 @@ GameObjectState GameObject::getState() const noexcept {
 };
 
 bool GameObject::hasComponentType(ComponentType type) const noexcept {
-  return this->searchComponentsByType(type) != this->components.end();
+  return (this->component_mask & GameObject::componentTypeBit(type)) != 0;
 };
 
 bool GameObject::isAlive() const noexcept {
   return this->state == GameObjectState::AliveState;
 };
 
+bool GameObject::isVisibleInFrame(unsigned long frame) const noexcept {
+  return this->visible_frame == frame;
+};
+
+void GameObject::markVisibleInFrame(unsigned long frame) noexcept {
+  this->visible_frame = frame;
+};
+
+void GameObject::notifyCollision(GameObject& other) {
+  // Index loop, since a collision response may add components.
+  for(size_t index = 0; index < this->components.size(); index++)
+    this->components[index]->notifyCollision(other);
+};
+
+void GameObject::recordPreviousBox() noexcept {
+  this->previous_box = this->box;
+  this->previous_box_recorded = true;
+};
+
 void GameObject::removeComponent(Component* removal_target) {
   component_const_iter removal_position = this->searchComponentsByValue(
     removal_target
@@ -57,18 +168,24 @@ void GameObject::removeComponent(Component* removal_target) {
 };
 
 void GameObject::removeComponent(ComponentType removal_target_type) {
-  component_const_iter removal_position = this->searchComponentsByType(
-    removal_target_type
+  component_const_iter removal_position = this->searchComponentsByValue(
+    this->component_slots[removal_target_type]
   );
 
   this->eraseComponentAtPosition(removal_position);
 };
 
-void GameObject::render(SDL_Renderer* renderer) {
+void GameObject::render(SDL_Renderer* renderer, double interpolation_factor) {
+  this->updateRenderBox(interpolation_factor);
+
   for(auto& component : this->components)
     component->render(renderer);
 };
 
+void GameObject::recordDeath() noexcept {
+  this->death_recorded = true;
+};
+
 void GameObject::requestDeletion() noexcept {
   this->state = GameObjectState::DeletionState;
 };
@@ -84,26 +201,122 @@ void GameObject::setCenterCoordinates(
 ) noexcept {
   this->box.upper_left_corner = \
     center_coordinates - this->box.vectorFromUpperLeftCornerToCenter();
+  this->updateSpatialIndex();
 };
 
 void GameObject::setDimensions(double width, double height) noexcept {
   this->box.width = width;
   this->box.height = height;
+  this->updateSpatialIndex();
+};
+
+void GameObject::setSpawnOrder(unsigned long spawn_order) noexcept {
+  this->spawn_order = spawn_order;
+};
+
+Rectangle GameObject::sweptBox() const noexcept {
+  double left, top, right, bottom;
+
+  if(!this->previous_box_recorded)
+    return this->box;
+
+  // Covers every interpolated box drawn between the last two steps.
+  left = std::min(
+    this->previous_box.upper_left_corner.x,
+    this->box.upper_left_corner.x
+  );
+  top = std::min(
+    this->previous_box.upper_left_corner.y,
+    this->box.upper_left_corner.y
+  );
+  right = std::max(
+    this->previous_box.upper_left_corner.x + this->previous_box.width,
+    this->box.upper_left_corner.x + this->box.width
+  );
+  bottom = std::max(
+    this->previous_box.upper_left_corner.y + this->previous_box.height,
+    this->box.upper_left_corner.y + this->box.height
+  );
+
+  return Rectangle(VectorR2(left, top), right - left, bottom - top);
 };
 
 void GameObject::update(double dt) {
+  // Components that keep to their own object already ran in parallel.
   for(auto& component : this->components)
-    component->update(dt);
+    if(ComponentRegistry::typeHasSerialUpdateWork(component->getType()))
+      component->update(dt);
+};
+
+void GameObject::updateInParallel(double dt, JobSystem& job_system) {
+  this->recordPreviousBox();
+
+  for(auto& component : this->components) {
+    if(ComponentRegistry::typeHasParallelUpdateWork(component->getType()))
+      component->update(dt);
+
+    component->updateInParallel(dt, job_system);
+  }
+};
+
+void GameObject::updateRenderBox(double interpolation_factor) noexcept {
+  this->render_box = this->interpolatedBox(interpolation_factor);
 };
 
 // Private method implementations.
+unsigned int GameObject::componentTypeBit(ComponentType type) noexcept {
+  return 1u << type;
+};
+
 void GameObject::eraseComponentAtPosition(
   component_const_iter removal_position
 ) {
-  if(removal_position != this->components.end())
+  ComponentType removed_type;
+
+  if(removal_position != this->components.end()) {
+    removed_type = (*removal_position)->getType();
+
+    if(this->component_registry != nullptr)
+      this->component_registry->unregisterComponent(removal_position->get());
+
     this->components.erase(removal_position);
+    this->refreshComponentSlot(removed_type);
+  }
 }
 
+Rectangle GameObject::interpolatedBox(
+  double interpolation_factor
+) const noexcept {
+  // Objects that were never updated have no previous state to blend from.
+  if(!this->previous_box_recorded)
+    return this->box;
+
+  return Rectangle(
+    this->previous_box.upper_left_corner + interpolation_factor * (
+      this->box.upper_left_corner - this->previous_box.upper_left_corner
+    ),
+    this->previous_box.width + interpolation_factor * (
+      this->box.width - this->previous_box.width
+    ),
+    this->previous_box.height + interpolation_factor * (
+      this->box.height - this->previous_box.height
+    )
+  );
+};
+
+void GameObject::refreshComponentSlot(ComponentType type) noexcept {
+  component_const_iter replacement = this->searchComponentsByType(type);
+
+  if(replacement != this->components.end()) {
+    this->component_slots[type] = replacement->get();
+    this->component_mask |= GameObject::componentTypeBit(type);
+  }
+  else {
+    this->component_slots[type] = nullptr;
+    this->component_mask &= ~GameObject::componentTypeBit(type);
+  }
+};
+
 component_const_iter GameObject::searchComponentsByType(
   ComponentType search_parameter
 ) const noexcept {
@@ -135,3 +348,18 @@ component_const_iter GameObject::searchComponentsByValue(
     component_matches_search_parameter
   );
 };
+
+void GameObject::updateSpatialIndex() noexcept {
+  if(this->spatial_index == nullptr)
+    return;
+
+  try {
+    this->spatial_index->update(this);
+  }
+  catch(std::exception& e) {
+    // The object keeps its old cells and may be missed by spatial queries.
+    std::cerr << "[GameObject] " << e.what() << "\n";
+    std::cerr << "[GameObject] Ignoring last exception and resuming "
+      "execution!\n";
+  }
+};
@@ -0,0 +1,199 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Input Manager class - Source code.
+
+// Class header include.
+#include "InputManager.hpp"
+
+// Class method implementations.
+InputManager::InputManager() noexcept :
+  performance_frequency(SDL_GetPerformanceFrequency())
+{
+  int mouse_x, mouse_y;
+
+  // Sampled once, since motion events keep the position current afterwards.
+  SDL_GetMouseState(&mouse_x, &mouse_y);
+  this->mouse_coordinates = VectorR2((double) mouse_x, (double) mouse_y);
+};
+
+// Public method implementations.
+size_t InputManager::countRecordedEvents() const noexcept {
+  return std::min(
+    this->recorded_event_count,
+    (unsigned long) INPUT_MANAGER_RING_BUFFER_SIZE
+  );
+};
+
+const InputLatencyStatistics& InputManager::getLatencyStatistics(
+  InputEventType type
+) const noexcept {
+  return this->latency_statistics[type];
+};
+
+const VectorR2& InputManager::getMouseCoordinates() const noexcept {
+  return this->mouse_coordinates;
+};
+
+const InputEvent& InputManager::getRecordedEvent(size_t age) const noexcept {
+  // Age zero is the newest event, older ones walk back around the ring.
+  size_t position = (
+    this->recorded_event_count - 1 - age
+  ) % INPUT_MANAGER_RING_BUFFER_SIZE;
+
+  return this->recorded_events[position];
+};
+
+void InputManager::markFramePresented() noexcept {
+  Uint64 present_counter = SDL_GetPerformanceCounter();
+  double latency;
+
+  // Every action handled since the last present first shows up in this one.
+  for(const auto& pending_presentation : this->pending_presentations) {
+    InputEventType type = pending_presentation.first;
+    InputLatencyStatistics& statistics = this->latency_statistics[type];
+
+    latency = (double) (present_counter - pending_presentation.second) / \
+      this->performance_frequency;
+
+    this->latency_sums[type] += latency;
+    statistics.last_latency = latency;
+    statistics.max_latency = std::max(statistics.max_latency, latency);
+    statistics.presented_events++;
+    statistics.mean_latency = this->latency_sums[type] / \
+      statistics.presented_events;
+  }
+
+  this->pending_presentations.clear();
+};
+
+size_t InputManager::pollEvents() {
+  SDL_Event event;
+  InputEvent input_event;
+  size_t polled_events = 0;
+
+  for(std::vector<InputEvent>& events : this->frame_events)
+    events.clear();
+
+  while(SDL_PollEvent(&event)) {
+    if(!this->classifyEvent(event, input_event))
+      continue;
+
+    this->recordEvent(input_event);
+    this->frame_events[input_event.type].push_back(input_event);
+    polled_events++;
+  }
+
+  this->dispatchFrameEvents();
+
+  return polled_events;
+};
+
+void InputManager::subscribe(
+  InputEventType type,
+  InputSubscriber subscriber
+) {
+  this->subscribers[type].push_back(std::move(subscriber));
+};
+
+// Private method implementations.
+bool InputManager::classifyEvent(
+  const SDL_Event& event,
+  InputEvent& input_event
+) noexcept {
+  input_event.timestamp = event.common.timestamp;
+  input_event.origin_counter = this->originCounterOf(event.common.timestamp);
+  input_event.keysym = SDL_Keysym();
+  input_event.button = 0;
+
+  switch (event.type) {
+    case SDL_KEYDOWN:
+      input_event.type = InputEventType::KeyDownInput;
+      input_event.keysym = event.key.keysym;
+      break;
+
+    // Clicks carry their own position, which may differ from the cursor's.
+    case SDL_MOUSEBUTTONDOWN:
+      input_event.type = InputEventType::MouseButtonDownInput;
+      input_event.button = event.button.button;
+      this->mouse_coordinates = VectorR2(
+        (double) event.button.x,
+        (double) event.button.y
+      );
+      break;
+
+    case SDL_MOUSEMOTION:
+      input_event.type = InputEventType::MouseMotionInput;
+      this->mouse_coordinates = VectorR2(
+        (double) event.motion.x,
+        (double) event.motion.y
+      );
+      break;
+
+    case SDL_QUIT:
+      input_event.type = InputEventType::QuitInput;
+      break;
+
+    default:
+      return false;
+  }
+
+  // Keys act where the cursor was as of this event, not as of the frame.
+  input_event.coordinates = this->mouse_coordinates;
+
+  return true;
+};
+
+void InputManager::dispatchFrameEvents() {
+  // Each type goes out as one batch, so handlers can share their lookups.
+  for(size_t type = 0; type < InputEventTypeCount; type++) {
+    const std::vector<InputEvent>& events = this->frame_events[type];
+
+    if(events.empty())
+      continue;
+
+    for(const InputSubscriber& subscriber : this->subscribers[type])
+      subscriber(events);
+
+    if(
+      this->subscribers[type].empty() ||
+      !InputManager::typeAwaitsPresentation((InputEventType) type)
+    )
+      continue;
+
+    for(const InputEvent& input_event : events)
+      this->pending_presentations.emplace_back(
+        input_event.type,
+        input_event.origin_counter
+      );
+  }
+};
+
+void InputManager::recordEvent(const InputEvent& input_event) {
+  this->recorded_events[
+    this->recorded_event_count % INPUT_MANAGER_RING_BUFFER_SIZE
+  ] = input_event;
+  this->recorded_event_count++;
+};
+
+Uint64 InputManager::originCounterOf(Uint32 timestamp) const noexcept {
+  Uint64 received_counter = SDL_GetPerformanceCounter();
+  Uint64 age_counter;
+
+  // Timestamps are in milliseconds since init, so wrapping is harmless.
+  age_counter = (Uint64) (Uint32) (SDL_GetTicks() - timestamp) * \
+    this->performance_frequency / 1000;
+
+  if(age_counter > received_counter)
+    return 0;
+
+  return received_counter - age_counter;
+};
+
+bool InputManager::typeAwaitsPresentation(InputEventType type) noexcept {
+  // Motion only moves the cursor, so only actions count towards latency.
+  return (
+    type == InputEventType::KeyDownInput ||
+    type == InputEventType::MouseButtonDownInput
+  );
+};
@@ -0,0 +1,319 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Job System class - Source code.
+
+// Class header include.
+#include "JobSystem.hpp"
+
+// Static member initializations.
+thread_local JobSystem* JobSystem::thread_job_system = nullptr;
+thread_local size_t JobSystem::thread_queue_index = 0;
+
+// Class method implementations.
+JobSystem::JobSystem() : JobSystem(JobSystem::defaultWorkerCount()) {};
+
+JobSystem::JobSystem(unsigned int worker_count) :
+  main_thread_id(std::this_thread::get_id())
+{
+  // Queue zero belongs to the main thread, and to any other outsider.
+  for(unsigned int queue = 0; queue <= worker_count; queue++)
+    this->queues.push_back(std::make_unique<JobQueue>());
+
+  // Started last, so workers only ever see fully constructed members.
+  for(unsigned int worker = 1; worker <= worker_count; worker++)
+    this->workers.emplace_back(&JobSystem::runWorker, this, worker);
+};
+
+JobSystem::~JobSystem() noexcept {
+  {
+    std::lock_guard<std::mutex> sleep_lock(this->sleep_mutex);
+    this->stop_requested = true;
+  }
+
+  this->work_condition.notify_all();
+
+  // Jobs still queued are dropped, so nothing may wait on them past here.
+  for(std::thread& worker : this->workers)
+    if(worker.joinable())
+      worker.join();
+};
+
+// Public method implementations.
+void JobSystem::enqueueMainThreadJob(JobFunction job) {
+  std::lock_guard<std::mutex> main_thread_lock(this->main_thread_mutex);
+  this->main_thread_jobs.push_back(std::move(job));
+};
+
+unsigned int JobSystem::getWorkerCount() const noexcept {
+  return this->workers.size();
+};
+
+void JobSystem::parallelFor(
+  size_t count,
+  size_t chunk_size,
+  const ParallelForFunction& body
+) {
+  std::vector<JobHandle> chunk_jobs;
+  std::exception_ptr error;
+
+  chunk_size = std::max(chunk_size, (size_t) 1);
+
+  if(count <= chunk_size || this->workers.empty()) {
+    body(0, count);
+    return;
+  }
+
+  // Reserved up front, so no scheduled chunk is lost to a failed push.
+  chunk_jobs.reserve((count - 1) / chunk_size);
+
+  // The caller takes the first chunk itself instead of idling meanwhile.
+  try {
+    for(size_t begin = chunk_size; begin < count; begin += chunk_size) {
+      size_t end = std::min(begin + chunk_size, count);
+
+      chunk_jobs.push_back(
+        this->schedule([&body, begin, end] { body(begin, end); })
+      );
+    }
+
+    body(0, chunk_size);
+  }
+  catch(...) {
+    error = std::current_exception();
+  }
+
+  // Every chunk borrows the body, so all of them finish before any rethrow.
+  for(const JobHandle& chunk_job : chunk_jobs) {
+    try {
+      this->wait(chunk_job);
+    }
+    catch(...) {
+      if(!error)
+        error = std::current_exception();
+    }
+  }
+
+  if(error)
+    std::rethrow_exception(error);
+};
+
+size_t JobSystem::runMainThreadJobs() noexcept {
+  std::vector<JobFunction> ready_jobs;
+  size_t completed_jobs = 0;
+
+  if(std::this_thread::get_id() != this->main_thread_id)
+    return 0;
+
+  // Jobs may enqueue follow-ups, which still run within this same call.
+  while(true) {
+    {
+      std::lock_guard<std::mutex> main_thread_lock(this->main_thread_mutex);
+      ready_jobs.swap(this->main_thread_jobs);
+    }
+
+    if(ready_jobs.empty())
+      return completed_jobs;
+
+    for(JobFunction& job : ready_jobs) {
+      try {
+        job();
+      }
+      catch(std::exception& e) {
+        std::cerr << "[JobSystem] " << e.what();
+        std::cerr << "[JobSystem] Ignoring last exception and resuming "
+          "execution!\n";
+      }
+
+      completed_jobs++;
+    }
+
+    ready_jobs.clear();
+  }
+};
+
+JobHandle JobSystem::schedule(
+  JobFunction job,
+  const std::vector<JobHandle>& dependencies
+) {
+  JobHandle new_job = std::make_shared<JobRecord>();
+
+  new_job->function = std::move(job);
+
+  // The initial count guards the job until every dependency is registered.
+  for(const JobHandle& dependency : dependencies) {
+    if(!dependency)
+      continue;
+
+    std::lock_guard<std::mutex> dependents_lock(dependency->dependents_mutex);
+
+    if(dependency->finished.load(std::memory_order_acquire))
+      continue;
+
+    dependency->dependents.push_back(new_job);
+    new_job->blocking_dependencies++;
+  }
+
+  if(new_job->blocking_dependencies.fetch_sub(1) == 1)
+    this->pushJob(new_job);
+
+  return new_job;
+};
+
+void JobSystem::wait(const JobHandle& job) {
+  if(!job)
+    return;
+
+  // Waiting threads help out, so a wait from inside a job cannot deadlock.
+  while(!job->finished.load(std::memory_order_acquire))
+    if(!this->runPendingJob())
+      std::this_thread::yield();
+
+  if(job->error)
+    std::rethrow_exception(job->error);
+};
+
+// Private method implementations.
+void JobSystem::finishJob(const JobHandle& job) noexcept {
+  std::vector<JobHandle> dependents;
+
+  {
+    std::lock_guard<std::mutex> dependents_lock(job->dependents_mutex);
+    job->finished.store(true, std::memory_order_release);
+    dependents.swap(job->dependents);
+  }
+
+  for(const JobHandle& dependent : dependents)
+    if(dependent->blocking_dependencies.fetch_sub(1) == 1)
+      this->releaseJob(dependent);
+};
+
+size_t JobSystem::ownQueueIndex() const noexcept {
+  if(JobSystem::thread_job_system != this)
+    return 0;
+
+  return JobSystem::thread_queue_index;
+};
+
+bool JobSystem::popJob(size_t queue_index, JobHandle& job) noexcept {
+  size_t queue_count = this->queues.size();
+
+  // Own jobs come off the back while they are still warm in the cache.
+  {
+    JobQueue& own_queue = *this->queues[queue_index];
+    std::lock_guard<std::mutex> queue_lock(own_queue.mutex);
+
+    if(!own_queue.jobs.empty()) {
+      job = std::move(own_queue.jobs.back());
+      own_queue.jobs.pop_back();
+      this->queued_jobs--;
+      return true;
+    }
+  }
+
+  // Thieves take the oldest jobs, which tend to be the largest leftovers.
+  for(size_t offset = 1; offset < queue_count; offset++) {
+    size_t victim_index = (queue_index + offset) % queue_count;
+    JobQueue& victim_queue = *this->queues[victim_index];
+    std::lock_guard<std::mutex> queue_lock(victim_queue.mutex);
+
+    if(!victim_queue.jobs.empty()) {
+      job = std::move(victim_queue.jobs.front());
+      victim_queue.jobs.pop_front();
+      this->queued_jobs--;
+      return true;
+    }
+  }
+
+  return false;
+};
+
+void JobSystem::pushJob(const JobHandle& job) {
+  JobQueue& own_queue = *this->queues[this->ownQueueIndex()];
+
+  {
+    std::lock_guard<std::mutex> queue_lock(own_queue.mutex);
+    own_queue.jobs.push_back(job);
+  }
+
+  this->queued_jobs++;
+
+  // Taking the lock orders this push before any worker's check for work.
+  {
+    std::lock_guard<std::mutex> sleep_lock(this->sleep_mutex);
+  }
+
+  this->work_condition.notify_one();
+};
+
+void JobSystem::releaseJob(const JobHandle& job) noexcept {
+  try {
+    this->pushJob(job);
+  }
+  catch(std::exception& e) {
+    // A job that cannot be queued still runs, only without the parallelism.
+    this->runJob(job);
+  }
+};
+
+void JobSystem::runJob(const JobHandle& job) noexcept {
+  try {
+    job->function();
+  }
+  catch(...) {
+    job->error = std::current_exception();
+  }
+
+  // Captures are released now instead of with the last handle.
+  job->function = nullptr;
+  this->finishJob(job);
+};
+
+bool JobSystem::runPendingJob() noexcept {
+  JobHandle job;
+
+  if(!this->popJob(this->ownQueueIndex(), job))
+    return false;
+
+  this->runJob(job);
+
+  return true;
+};
+
+void JobSystem::runWorker(size_t queue_index) noexcept {
+  JobHandle job;
+
+  JobSystem::thread_job_system = this;
+  JobSystem::thread_queue_index = queue_index;
+
+  while(true) {
+    if(this->popJob(queue_index, job)) {
+      this->runJob(job);
+      job = nullptr;
+      continue;
+    }
+
+    std::unique_lock<std::mutex> sleep_lock(this->sleep_mutex);
+
+    this->work_condition.wait(
+      sleep_lock,
+      [this] { return this->stop_requested || this->queued_jobs > 0; }
+    );
+
+    if(this->stop_requested)
+      return;
+  }
+};
+
+unsigned int JobSystem::defaultWorkerCount() noexcept {
+  unsigned int hardware_threads = std::thread::hardware_concurrency();
+
+  // The main thread runs jobs too whenever it waits, so it keeps a core.
+  if(hardware_threads <= 1)
+    return 0;
+
+  if(hardware_threads - 1 > JOB_SYSTEM_MAX_WORKER_COUNT)
+    return JOB_SYSTEM_MAX_WORKER_COUNT;
+
+  return hardware_threads - 1;
+};
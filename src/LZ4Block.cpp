@@ -0,0 +1,238 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - LZ4 Block class - Source code.
+
+// Class header include.
+#include "LZ4Block.hpp"
+
+// Public method implementations.
+int LZ4Block::compress(
+  const unsigned char* source,
+  size_t source_size,
+  std::vector<unsigned char>& compressed_block
+) noexcept {
+  size_t anchor = 0, position = 0, match_position, match_length;
+  uint32_t sequence;
+
+  try {
+    // Positions are stored off by one, so zero marks an empty slot.
+    std::vector<size_t> hash_table(1 << LZ4_BLOCK_HASH_BITS, 0);
+
+    compressed_block.clear();
+    compressed_block.reserve(source_size + source_size / 255 + 16);
+
+    // Greedy parse: take the first match found and never look back.
+    while(position + LZ4_BLOCK_MATCH_SEARCH_LIMIT <= source_size) {
+      sequence = LZ4Block::readSequence(source + position);
+      size_t& hash_slot = hash_table[LZ4Block::hashOf(sequence)];
+      match_position = hash_slot;
+      hash_slot = position + 1;
+
+      if(
+        match_position == 0 ||
+        position - (match_position - 1) > LZ4_BLOCK_MAX_OFFSET ||
+        LZ4Block::readSequence(source + match_position - 1) != sequence
+      ) {
+        position++;
+        continue;
+      }
+
+      match_position--;
+      match_length = LZ4_BLOCK_MIN_MATCH;
+
+      // Matches stop short of the tail, which the format keeps as literals.
+      while(
+        position + match_length < source_size - LZ4_BLOCK_LAST_LITERALS &&
+        source[match_position + match_length] == \
+          source[position + match_length]
+      )
+        match_length++;
+
+      LZ4Block::appendSequence(
+        compressed_block,
+        source + anchor,
+        position - anchor,
+        position - match_position,
+        match_length
+      );
+
+      position += match_length;
+      anchor = position;
+    }
+
+    LZ4Block::appendSequence(
+      compressed_block,
+      source + anchor,
+      source_size - anchor,
+      0,
+      0
+    );
+  }
+  catch(std::exception& e) {
+    return -1;
+  }
+
+  return 0;
+};
+
+int LZ4Block::decompress(
+  const unsigned char* compressed_block,
+  size_t compressed_size,
+  unsigned char* destination,
+  size_t destination_size
+) noexcept {
+  size_t input = 0, output = 0, literal_length, match_length, match_offset;
+  unsigned char token;
+
+  // Every length and offset is checked, since the input may be corrupted.
+  while(input < compressed_size) {
+    token = compressed_block[input++];
+    literal_length = token >> 4;
+
+    if(
+      literal_length == 15 &&
+      LZ4Block::readLength(
+        compressed_block,
+        compressed_size,
+        input,
+        literal_length
+      ) != 0
+    )
+      return -1;
+
+    if(
+      literal_length > compressed_size - input ||
+      literal_length > destination_size - output
+    )
+      return -1;
+
+    if(literal_length != 0)
+      std::memcpy(
+        destination + output,
+        compressed_block + input,
+        literal_length
+      );
+
+    input += literal_length;
+    output += literal_length;
+
+    // The last sequence holds literals only.
+    if(input == compressed_size)
+      break;
+
+    if(compressed_size - input < 2)
+      return -1;
+
+    match_offset = compressed_block[input] | (compressed_block[input + 1] << 8);
+    input += 2;
+    match_length = token & 0x0F;
+
+    if(match_offset == 0 || match_offset > output)
+      return -1;
+
+    if(
+      match_length == 15 &&
+      LZ4Block::readLength(
+        compressed_block,
+        compressed_size,
+        input,
+        match_length
+      ) != 0
+    )
+      return -1;
+
+    match_length += LZ4_BLOCK_MIN_MATCH;
+
+    if(match_length > destination_size - output)
+      return -1;
+
+    // Overlapping matches repeat recent bytes, so copy them one at a time.
+    for(size_t index = 0; index < match_length; index++)
+      destination[output + index] = destination[
+        output - match_offset + index
+      ];
+
+    output += match_length;
+  }
+
+  return output == destination_size ? 0 : -1;
+};
+
+// Private method implementations.
+void LZ4Block::appendLength(
+  std::vector<unsigned char>& compressed_block,
+  size_t length
+) {
+  while(length >= 255) {
+    compressed_block.push_back(255);
+    length -= 255;
+  }
+
+  compressed_block.push_back(length);
+};
+
+void LZ4Block::appendSequence(
+  std::vector<unsigned char>& compressed_block,
+  const unsigned char* literals,
+  size_t literal_length,
+  size_t match_offset,
+  size_t match_length
+) {
+  size_t match_extra = match_length - LZ4_BLOCK_MIN_MATCH;
+  unsigned char token = (literal_length < 15 ? literal_length : 15) << 4;
+
+  if(match_length != 0)
+    token |= match_extra < 15 ? match_extra : 15;
+
+  compressed_block.push_back(token);
+
+  if(literal_length >= 15)
+    LZ4Block::appendLength(compressed_block, literal_length - 15);
+
+  compressed_block.insert(
+    compressed_block.end(),
+    literals,
+    literals + literal_length
+  );
+
+  if(match_length == 0)
+    return;
+
+  compressed_block.push_back(match_offset & 0xFF);
+  compressed_block.push_back(match_offset >> 8);
+
+  if(match_extra >= 15)
+    LZ4Block::appendLength(compressed_block, match_extra - 15);
+};
+
+uint32_t LZ4Block::hashOf(uint32_t sequence) noexcept {
+  return (sequence * 2654435761u) >> (32 - LZ4_BLOCK_HASH_BITS);
+};
+
+int LZ4Block::readLength(
+  const unsigned char* compressed_block,
+  size_t compressed_size,
+  size_t& position,
+  size_t& length
+) noexcept {
+  unsigned char length_byte;
+
+  do {
+    if(position >= compressed_size)
+      return -1;
+
+    length_byte = compressed_block[position++];
+    length += length_byte;
+  } while(length_byte == 255);
+
+  return 0;
+};
+
+uint32_t LZ4Block::readSequence(const unsigned char* source) noexcept {
+  uint32_t sequence;
+
+  std::memcpy(&sequence, source, sizeof(uint32_t));
+
+  return sequence;
+};
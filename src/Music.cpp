@@ -11,6 +11,10 @@ Music::Music(std::string file) {
   this->open(file);
 };
 
+Music::Music(const AssetArchive& asset_archive, std::string id) {
+  this->open(asset_archive, id);
+};
+
 // Public method implementations.
 bool Music::isOpen() const noexcept {
   return (this->music.get() != nullptr);
@@ -20,14 +24,33 @@ bool Music::isUsingMixer() const noexcept {
   return this->usingMixer;
 };
 
+void Music::open(const AssetArchive& asset_archive, std::string id) {
+  // The track streams from the archive, which must outlive this music.
+  Mix_Music* decoded_music = Mix_LoadMUS_RW(asset_archive.openAsset(id), 1);
+
+  if(decoded_music == nullptr)
+    throw OpenMusicException(OpenMusicErrorCode::LoadMusicError);
+
+  this->music = MixMusicSharedPTR(decoded_music, &Mix_FreeMusic);
+};
+
+void Music::open(MixMusicSharedPTR decoded_music) {
+  if(!decoded_music)
+    throw OpenMusicException(OpenMusicErrorCode::LoadMusicError);
+
+  this->music = decoded_music;
+};
+
 void Music::open(std::string file) {
-  this->music.reset(Mix_LoadMUS(file.c_str()));
+  Mix_Music* decoded_music = Mix_LoadMUS(file.c_str());
 
-  if(!this->music)
+  if(decoded_music == nullptr)
     throw OpenMusicException(OpenMusicErrorCode::LoadMusicError);
+
+  this->music = MixMusicSharedPTR(decoded_music, &Mix_FreeMusic);
 };
 
-void Music::play(int times) {
+void Music::play(int times, unsigned int fade_in_duration_milliseconds) {
   if(!this->isOpen())
     throw PlayMusicException(PlayMusicErrorCode::PlayUnopenedMusicError);
 
@@ -37,7 +60,12 @@ void Music::play(int times) {
   else if(this->mixerInUse())
     throw PlayMusicException(PlayMusicErrorCode::MixerInUseError);
 
-  else if(this->useMixerToPlayCurrentMusic(times) != 0)
+  else if(
+    this->useMixerToPlayCurrentMusic(
+      times,
+      fade_in_duration_milliseconds
+    ) != 0
+  )
     throw PlayMusicException(PlayMusicErrorCode::FailureToPlayMusicError);
 };
 
@@ -198,8 +226,22 @@ bool Music::mixerInUse() const noexcept {
   return (Mix_PlayingMusic() && Mix_FadingMusic() != MIX_FADING_OUT);
 };
 
-int Music::useMixerToPlayCurrentMusic(int times) noexcept {
-  if(Mix_PlayMusic(this->music.get(), times) != 0)
+int Music::useMixerToPlayCurrentMusic(
+  int times,
+  unsigned int fade_in_duration_milliseconds
+) noexcept {
+  int play_result;
+
+  if(fade_in_duration_milliseconds == 0)
+    play_result = Mix_PlayMusic(this->music.get(), times);
+  else
+    play_result = Mix_FadeInMusic(
+      this->music.get(),
+      times,
+      fade_in_duration_milliseconds
+    );
+
+  if(play_result != 0)
     return -1;
 
   this->usingMixer = true;
@@ -209,7 +251,8 @@ int Music::useMixerToPlayCurrentMusic(int times) noexcept {
 int Music::useMixerToStopCurrentMusic(
   unsigned int fade_out_duration_milliseconds
 ) noexcept {
-  if(Mix_FadeOutMusic(fade_out_duration_milliseconds) != 0)
+  // Unlike the play calls, fading out returns one on success.
+  if(Mix_FadeOutMusic(fade_out_duration_milliseconds) == 0)
     return -1;
 
   this->usingMixer = false;
@@ -0,0 +1,256 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Music Manager class - Source code.
+
+// Class header include.
+#include "MusicManager.hpp"
+
+// Class method implementations.
+MusicManager::MusicManager(
+  AssetLoader& asset_loader,
+  size_t cache_capacity
+) noexcept :
+  asset_loader(asset_loader),
+  cache_capacity(std::max(cache_capacity, (size_t) 1)) {};
+
+// Public method implementations.
+const std::string& MusicManager::getCurrentTrack() const noexcept {
+  return this->current_track;
+};
+
+const MusicStatistics& MusicManager::getStatistics() const noexcept {
+  return this->statistics;
+};
+
+bool MusicManager::isCached(const std::string& id) const noexcept {
+  return std::any_of(
+    this->cache.begin(),
+    this->cache.end(),
+    [&id](const MusicCacheEntry& entry) {
+      return entry.id == id;
+    }
+  );
+};
+
+bool MusicManager::isSwitching() const noexcept {
+  return this->switch_pending;
+};
+
+void MusicManager::play(
+  const std::string& id,
+  unsigned int crossfade_duration_milliseconds
+) {
+  unsigned int fade_out_duration_milliseconds = \
+    crossfade_duration_milliseconds / 2;
+
+  if(
+    this->switch_pending ?
+      id == this->next_track :
+      id == this->current_track && this->music.isUsingMixer()
+  )
+    return;
+
+  this->preload(id);
+
+  // The new track starts from update, once the old one has faded out.
+  this->next_track = id;
+  this->fade_in_duration_milliseconds = \
+    crossfade_duration_milliseconds - fade_out_duration_milliseconds;
+  this->switch_pending = true;
+
+  this->fadeOutCurrentTrack(fade_out_duration_milliseconds);
+};
+
+void MusicManager::preload(const std::string& id) {
+  if(this->isCached(id) || this->preloads.count(id) != 0)
+    return;
+
+  this->statistics.cache_misses++;
+  this->preloads.emplace(
+    id,
+    MusicPreload{
+      .handle = this->asset_loader.requestMusic(id),
+      .request_counter = SDL_GetPerformanceCounter()
+    }
+  );
+};
+
+void MusicManager::setCacheCapacity(size_t cache_capacity) noexcept {
+  this->cache_capacity = std::max(cache_capacity, (size_t) 1);
+  this->trimCache();
+};
+
+void MusicManager::stop(unsigned int fade_out_duration_milliseconds) noexcept {
+  this->switch_pending = false;
+  this->next_track.clear();
+  this->current_track.clear();
+
+  this->fadeOutCurrentTrack(fade_out_duration_milliseconds);
+};
+
+void MusicManager::update() noexcept {
+  Uint64 switch_start_counter;
+  double switch_time;
+
+  this->pollPreloads();
+
+  if(
+    !this->switch_pending ||
+    !this->isCached(this->next_track) ||
+    this->streamIsBusy()
+  )
+    return;
+
+  switch_start_counter = SDL_GetPerformanceCounter();
+  this->startNextTrack();
+  switch_time = (double) (
+    SDL_GetPerformanceCounter() - switch_start_counter
+  ) / SDL_GetPerformanceFrequency();
+
+  this->statistics.max_switch_time = std::max(
+    this->statistics.max_switch_time,
+    switch_time
+  );
+};
+
+// Private method implementations.
+MixMusicSharedPTR MusicManager::acquireCachedMusic(
+  const std::string& id
+) noexcept {
+  auto cached_entry = std::find_if(
+    this->cache.begin(),
+    this->cache.end(),
+    [&id](const MusicCacheEntry& entry) {
+      return entry.id == id;
+    }
+  );
+
+  if(cached_entry == this->cache.end())
+    return MixMusicSharedPTR();
+
+  // Moved to the front, so eviction from the back spares it longest.
+  std::rotate(this->cache.begin(), cached_entry, cached_entry + 1);
+  this->statistics.cache_hits++;
+
+  return this->cache.front().music;
+};
+
+void MusicManager::cacheMusic(
+  const std::string& id,
+  MixMusicSharedPTR music
+) {
+  this->cache.insert(
+    this->cache.begin(),
+    {.id = id, .music = std::move(music)}
+  );
+
+  this->trimCache();
+};
+
+void MusicManager::fadeOutCurrentTrack(
+  unsigned int fade_out_duration_milliseconds
+) noexcept {
+  if(!this->music.isUsingMixer())
+    return;
+
+  try {
+    this->music.stop(fade_out_duration_milliseconds);
+  }
+  catch(StopMusicException& stop_music_exception) {
+    std::cerr << "[MusicManager] " << stop_music_exception.what();
+    std::cerr << "[MusicManager] Ignoring last exception and resuming "
+      "execution!\n";
+  }
+};
+
+void MusicManager::pollPreloads() noexcept {
+  auto preload = this->preloads.begin();
+
+  while(preload != this->preloads.end()) {
+    if(!preload->second.handle.isDone()) {
+      preload++;
+      continue;
+    }
+
+    this->statistics.last_preload_time = (double) (
+      SDL_GetPerformanceCounter() - preload->second.request_counter
+    ) / SDL_GetPerformanceFrequency();
+
+    try {
+      if(preload->second.handle.failed())
+        throw OpenMusicException(OpenMusicErrorCode::LoadMusicError);
+
+      const DecodedMusic& decoded_music = preload->second.handle.get();
+
+      // Measured on the worker, apart from the time spent queued behind jobs.
+      this->statistics.last_decode_time = decoded_music.decode_time;
+      this->statistics.max_decode_time = std::max(
+        this->statistics.max_decode_time,
+        decoded_music.decode_time
+      );
+
+      this->cacheMusic(preload->first, decoded_music.music);
+    }
+    catch(std::exception& e) {
+      std::cerr << "[MusicManager] " << e.what();
+      std::cerr << "[MusicManager] Ignoring last exception and resuming "
+        "execution!\n";
+
+      // A track that cannot load is not waited on forever.
+      this->statistics.failed_loads++;
+      if(this->switch_pending && preload->first == this->next_track)
+        this->switch_pending = false;
+    }
+
+    preload = this->preloads.erase(preload);
+  }
+};
+
+int MusicManager::startNextTrack() noexcept {
+  MixMusicSharedPTR next_music = this->acquireCachedMusic(this->next_track);
+
+  this->switch_pending = false;
+
+  try {
+    this->music.open(next_music);
+    this->music.play(-1, this->fade_in_duration_milliseconds);
+  }
+  catch(std::exception& e) {
+    std::cerr << "[MusicManager] " << e.what();
+    std::cerr << "[MusicManager] Ignoring last exception and resuming "
+      "execution!\n";
+    return -1;
+  }
+
+  this->current_track = this->next_track;
+  this->statistics.track_switches++;
+
+  // The previous track is no longer protected, so the overflow is paid back.
+  this->trimCache();
+
+  return 0;
+};
+
+bool MusicManager::streamIsBusy() const noexcept {
+  // Still true while the old track fades out, which is what is waited on.
+  return Mix_PlayingMusic() != 0;
+};
+
+void MusicManager::trimCache() noexcept {
+  size_t entry = this->cache.size();
+
+  // Least recently used first, skipping the tracks a switch still needs.
+  while(this->cache.size() > this->cache_capacity && entry > 0) {
+    entry--;
+
+    if(
+      this->cache[entry].id == this->current_track ||
+      (this->switch_pending && this->cache[entry].id == this->next_track)
+    )
+      continue;
+
+    this->cache.erase(this->cache.begin() + entry);
+    this->statistics.cache_evictions++;
+  }
+};
@@ -0,0 +1,242 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Profiler class - Source code.
+
+// Class header include.
+#include "Profiler.hpp"
+
+// Static member initializations.
+Uint64 Profiler::epoch_counter = 0;
+double Profiler::frame_budget = 0;
+std::array<double, PROFILER_OVERLAY_FRAME_COUNT> Profiler::frame_durations = {};
+Uint64 Profiler::last_frame_counter = 0;
+unsigned long Profiler::recorded_frames = 0;
+std::vector<std::shared_ptr<ProfileRingBuffer>> Profiler::ring_buffers;
+std::mutex Profiler::ring_buffers_mutex;
+
+// Class method implementations.
+ProfileScope::ProfileScope(const char* scope_name) noexcept :
+  scope_name(scope_name),
+  start_counter(SDL_GetPerformanceCounter())
+{};
+
+ProfileScope::~ProfileScope() noexcept {
+  Profiler::recordSample({
+    .name = this->scope_name,
+    .start_counter = this->start_counter,
+    .end_counter = SDL_GetPerformanceCounter()
+  });
+};
+
+// Public method implementations.
+int Profiler::exportChromeTrace(const std::string& trace_file) noexcept {
+  std::lock_guard<std::mutex> ring_buffers_lock(Profiler::ring_buffers_mutex);
+  bool first_event = true;
+
+  try {
+    std::ofstream trace_stream(trace_file);
+    std::vector<ProfileSample> copied_samples;
+
+    if(!trace_stream.is_open())
+      return -1;
+
+    copied_samples.reserve(PROFILER_RING_BUFFER_SIZE);
+    trace_stream << std::fixed << std::setprecision(3);
+    trace_stream << "{\"traceEvents\":[";
+
+    for(auto& ring_buffer : Profiler::ring_buffers) {
+      unsigned long recorded_samples = ring_buffer->recorded_samples.load(
+        std::memory_order_acquire
+      );
+      unsigned long first_index = recorded_samples > PROFILER_RING_BUFFER_SIZE ?
+        recorded_samples - PROFILER_RING_BUFFER_SIZE :
+        0;
+      unsigned long intact_index;
+
+      // Workers keep recording, so the slots are copied out before writing.
+      copied_samples.clear();
+      for(unsigned long index = first_index; index < recorded_samples; index++)
+        copied_samples.push_back(
+          ring_buffer->samples[index % PROFILER_RING_BUFFER_SIZE]
+        );
+
+      // Slots lapped meanwhile, or being written right now, are dropped.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      intact_index = ring_buffer->recorded_samples.load(
+        std::memory_order_acquire
+      ) + 1;
+      intact_index = intact_index > PROFILER_RING_BUFFER_SIZE ?
+        intact_index - PROFILER_RING_BUFFER_SIZE :
+        0;
+
+      // Oldest surviving sample first, so the trace reads chronologically.
+      for(
+        unsigned long index = std::max(first_index, intact_index);
+        index < recorded_samples;
+        index++
+      ) {
+        if(!first_event)
+          trace_stream << ",";
+
+        Profiler::writeTraceEvent(
+          trace_stream,
+          copied_samples[index - first_index],
+          ring_buffer->thread_index
+        );
+        first_event = false;
+      }
+    }
+
+    trace_stream << "]}\n";
+  }
+  catch(std::exception& e) {
+    std::cerr << "[Profiler] " << e.what();
+    return -1;
+  }
+
+  return 0;
+};
+
+void Profiler::markFrameBoundary() noexcept {
+  Uint64 frame_counter = SDL_GetPerformanceCounter();
+
+  if(Profiler::last_frame_counter != 0) {
+    Profiler::frame_durations[
+      Profiler::recorded_frames % PROFILER_OVERLAY_FRAME_COUNT
+    ] = (double) (frame_counter - Profiler::last_frame_counter) / \
+      SDL_GetPerformanceFrequency();
+    Profiler::recorded_frames++;
+  }
+
+  Profiler::last_frame_counter = frame_counter;
+};
+
+void Profiler::recordSample(const ProfileSample& sample) noexcept {
+  ProfileRingBuffer* ring_buffer;
+  unsigned long sample_index;
+
+  try {
+    ring_buffer = &Profiler::threadRingBuffer();
+  }
+  catch(std::exception& e) {
+    return;
+  }
+
+  // Only the owning thread writes; the release pairs with the exporter.
+  sample_index = ring_buffer->recorded_samples.load(std::memory_order_relaxed);
+  ring_buffer->samples[sample_index % PROFILER_RING_BUFFER_SIZE] = sample;
+  ring_buffer->recorded_samples.store(
+    sample_index + 1,
+    std::memory_order_release
+  );
+};
+
+void Profiler::renderOverlay(SDL_Renderer* renderer) noexcept {
+  SDL_Rect viewport, bar;
+  Uint8 red, green, blue, alpha;
+  unsigned long frame_count = Profiler::recorded_frames;
+  unsigned long first_frame = frame_count > PROFILER_OVERLAY_FRAME_COUNT ?
+    frame_count - PROFILER_OVERLAY_FRAME_COUNT :
+    0;
+  int baseline, budget_height;
+
+  SDL_RenderGetViewport(renderer, &viewport);
+  SDL_GetRenderDrawColor(renderer, &red, &green, &blue, &alpha);
+
+  baseline = viewport.h - PROFILER_OVERLAY_MARGIN;
+  budget_height = (int) (
+    1000 * Profiler::frame_budget * PROFILER_OVERLAY_PIXELS_PER_MILLISECOND
+  );
+
+  // One bar per frame, oldest on the left; red bars blew the frame budget.
+  for(unsigned long frame = first_frame; frame < frame_count; frame++) {
+    double frame_duration = Profiler::frame_durations[
+      frame % PROFILER_OVERLAY_FRAME_COUNT
+    ];
+
+    bar.w = PROFILER_OVERLAY_BAR_WIDTH - 1;
+    bar.h = (int) (
+      1000 * frame_duration * PROFILER_OVERLAY_PIXELS_PER_MILLISECOND
+    );
+    bar.x = PROFILER_OVERLAY_MARGIN + \
+      (int) (frame - first_frame) * PROFILER_OVERLAY_BAR_WIDTH;
+    bar.y = baseline - bar.h;
+
+    if(Profiler::frame_budget > 0 && frame_duration > Profiler::frame_budget)
+      SDL_SetRenderDrawColor(renderer, 220, 40, 40, 255);
+    else
+      SDL_SetRenderDrawColor(renderer, 40, 200, 80, 255);
+
+    SDL_RenderFillRect(renderer, &bar);
+  }
+
+  if(budget_height > 0) {
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderDrawLine(
+      renderer,
+      PROFILER_OVERLAY_MARGIN,
+      baseline - budget_height,
+      PROFILER_OVERLAY_MARGIN + \
+        PROFILER_OVERLAY_FRAME_COUNT * PROFILER_OVERLAY_BAR_WIDTH,
+      baseline - budget_height
+    );
+  }
+
+  SDL_SetRenderDrawColor(renderer, red, green, blue, alpha);
+};
+
+void Profiler::setFrameBudget(double frame_budget) noexcept {
+  Profiler::frame_budget = frame_budget;
+};
+
+// Private method implementations.
+double Profiler::microsecondsSinceEpoch(Uint64 counter) noexcept {
+  return 1e6 * (double) (Sint64) (counter - Profiler::epoch_counter) / \
+    SDL_GetPerformanceFrequency();
+};
+
+ProfileRingBuffer& Profiler::threadRingBuffer() {
+  static thread_local std::shared_ptr<ProfileRingBuffer> thread_ring_buffer;
+
+  // Buffers outlive their threads, so an export still sees their samples.
+  if(thread_ring_buffer == nullptr) {
+    std::lock_guard<std::mutex> ring_buffers_lock(
+      Profiler::ring_buffers_mutex
+    );
+
+    if(Profiler::ring_buffers.empty())
+      Profiler::epoch_counter = SDL_GetPerformanceCounter();
+
+    thread_ring_buffer = std::make_shared<ProfileRingBuffer>();
+    thread_ring_buffer->recorded_samples.store(0);
+    thread_ring_buffer->thread_index = Profiler::ring_buffers.size();
+    Profiler::ring_buffers.push_back(thread_ring_buffer);
+  }
+
+  return *thread_ring_buffer;
+};
+
+void Profiler::writeTraceEvent(
+  std::ofstream& trace_stream,
+  const ProfileSample& sample,
+  unsigned long thread_index
+) {
+  double start = Profiler::microsecondsSinceEpoch(sample.start_counter);
+  double end = Profiler::microsecondsSinceEpoch(sample.end_counter);
+
+  trace_stream << "{\"name\":\"";
+
+  // Scope names are code literals, but keep the JSON valid regardless.
+  for(const char* character = sample.name; *character != '\0'; character++) {
+    if(*character == '"' || *character == '\\')
+      trace_stream << '\\';
+
+    trace_stream << *character;
+  }
+
+  trace_stream
+    << "\",\"cat\":\"frame\",\"ph\":\"X\","
+    << "\"ts\":" << start << ",\"dur\":" << end - start << ","
+    << "\"pid\":1,\"tid\":" << thread_index << "}";
+};
@@ -0,0 +1,189 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Raw Texture class - Source code.
+
+// Class header include.
+#include "RawTexture.hpp"
+
+// Public method implementations.
+int RawTexture::encode(
+  SDL_Surface* surface,
+  RawTextureCompression compression,
+  std::vector<unsigned char>& raw_texture
+) noexcept {
+  RawTextureHeader header = {};
+  SDL_Surface* converted_surface;
+  std::vector<unsigned char> pixel_data, compressed_data;
+  const std::vector<unsigned char>* payload = &pixel_data;
+
+  converted_surface = SDL_ConvertSurfaceFormat(
+    surface,
+    RAW_TEXTURE_PIXEL_FORMAT,
+    0
+  );
+
+  if(converted_surface == nullptr)
+    return -1;
+
+  std::memcpy(header.magic, RAW_TEXTURE_MAGIC, RAW_TEXTURE_MAGIC_SIZE);
+  header.version = RAW_TEXTURE_VERSION;
+  header.pixel_format = RAW_TEXTURE_PIXEL_FORMAT;
+  header.width = converted_surface->w;
+  header.height = converted_surface->h;
+  header.pitch = converted_surface->w * \
+    SDL_BYTESPERPIXEL(RAW_TEXTURE_PIXEL_FORMAT);
+  header.compression = RawTextureCompression::RawTextureUncompressed;
+  header.pixel_data_size = (uint64_t) header.pitch * header.height;
+
+  if(SDL_LockSurface(converted_surface) != 0) {
+    SDL_FreeSurface(converted_surface);
+    return -1;
+  }
+
+  try {
+    pixel_data.resize(header.pixel_data_size);
+
+    // Rows are stored tightly packed, whatever the surface pitch was.
+    for(uint32_t row = 0; row < header.height; row++)
+      std::memcpy(
+        pixel_data.data() + row * header.pitch,
+        (const unsigned char*) converted_surface->pixels + \
+          row * converted_surface->pitch,
+        header.pitch
+      );
+
+    // Pixels that do not shrink are kept raw, which loads without a copy.
+    if(
+      compression == RawTextureCompression::RawTextureLZ4 &&
+      LZ4Block::compress(
+        pixel_data.data(),
+        pixel_data.size(),
+        compressed_data
+      ) == 0 &&
+      compressed_data.size() < pixel_data.size()
+    ) {
+      header.compression = RawTextureCompression::RawTextureLZ4;
+      payload = &compressed_data;
+    }
+
+    header.payload_size = payload->size();
+
+    raw_texture.assign(
+      (const unsigned char*) &header,
+      (const unsigned char*) &header + sizeof(RawTextureHeader)
+    );
+    raw_texture.insert(raw_texture.end(), payload->begin(), payload->end());
+  }
+  catch(std::exception& e) {
+    SDL_UnlockSurface(converted_surface);
+    SDL_FreeSurface(converted_surface);
+    return -1;
+  }
+
+  SDL_UnlockSurface(converted_surface);
+  SDL_FreeSurface(converted_surface);
+
+  return 0;
+};
+
+int RawTexture::encodeImageFile(
+  const std::string& image_file,
+  RawTextureCompression compression,
+  std::vector<unsigned char>& raw_texture
+) noexcept {
+  int encode_result;
+  SDL_Surface* surface = IMG_Load(image_file.c_str());
+
+  if(surface == nullptr)
+    return -1;
+
+  encode_result = RawTexture::encode(surface, compression, raw_texture);
+  SDL_FreeSurface(surface);
+
+  return encode_result;
+};
+
+bool RawTexture::isRawTexture(const void* data, size_t size) noexcept {
+  return (
+    size >= RAW_TEXTURE_MAGIC_SIZE &&
+    std::memcmp(data, RAW_TEXTURE_MAGIC, RAW_TEXTURE_MAGIC_SIZE) == 0
+  );
+};
+
+SDL_Surface* RawTexture::loadSurface(const void* data, size_t size) noexcept {
+  RawTextureHeader header;
+  SDL_Surface* surface;
+  const unsigned char* payload = (const unsigned char*) data + \
+    sizeof(RawTextureHeader);
+
+  if(RawTexture::readHeader(data, size, header) != 0)
+    return nullptr;
+
+  // Uncompressed pixels are used in place, so they must outlive the surface.
+  // Nothing writes to them: surfaces are only read when creating textures.
+  if(header.compression == RawTextureCompression::RawTextureUncompressed)
+    return SDL_CreateRGBSurfaceWithFormatFrom(
+      (void*) payload,
+      header.width,
+      header.height,
+      SDL_BITSPERPIXEL(header.pixel_format),
+      header.pitch,
+      header.pixel_format
+    );
+
+  surface = SDL_CreateRGBSurfaceWithFormat(
+    0,
+    header.width,
+    header.height,
+    SDL_BITSPERPIXEL(header.pixel_format),
+    header.pixel_format
+  );
+
+  if(surface == nullptr)
+    return nullptr;
+
+  if(
+    (uint32_t) surface->pitch != header.pitch ||
+    LZ4Block::decompress(
+      payload,
+      header.payload_size,
+      (unsigned char*) surface->pixels,
+      header.pixel_data_size
+    ) != 0
+  ) {
+    SDL_FreeSurface(surface);
+    return nullptr;
+  }
+
+  return surface;
+};
+
+// Private method implementations.
+int RawTexture::readHeader(
+  const void* data,
+  size_t size,
+  RawTextureHeader& header
+) noexcept {
+  if(size < sizeof(RawTextureHeader) || !RawTexture::isRawTexture(data, size))
+    return -1;
+
+  // Fields are copied out, since the data makes no alignment promises.
+  std::memcpy(&header, data, sizeof(RawTextureHeader));
+
+  if(
+    header.version != RAW_TEXTURE_VERSION ||
+    header.pixel_format != RAW_TEXTURE_PIXEL_FORMAT ||
+    header.width == 0 ||
+    header.height == 0 ||
+    header.width > header.pitch / SDL_BYTESPERPIXEL(header.pixel_format) ||
+    header.pixel_data_size != (uint64_t) header.pitch * header.height ||
+    header.payload_size > size - sizeof(RawTextureHeader)
+  )
+    return -1;
+
+  if(header.compression == RawTextureCompression::RawTextureUncompressed)
+    return header.payload_size == header.pixel_data_size ? 0 : -1;
+
+  return header.compression == RawTextureCompression::RawTextureLZ4 ? 0 : -1;
+};
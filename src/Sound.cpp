@@ -6,6 +6,9 @@
 // Class header include.
 #include "Sound.hpp"
 
+// Static member initializations.
+std::vector<unsigned long> Sound::channel_generations;
+
 // Class method implementations.
 Sound::Sound(
   GameObject& associated
@@ -21,6 +24,48 @@ Sound::Sound(
   this->attachToAssociatedGameObject();
 };
 
+Sound::Sound(
+  GameObject& associated,
+  SoundChunkCache& sound_chunk_cache,
+  std::string file
+) : Component(associated, ComponentType::SoundComponent) {
+  this->open(sound_chunk_cache, file);
+  this->attachToAssociatedGameObject();
+};
+
+Sound::Sound(
+  GameObject& associated,
+  SoundChunkCache& sound_chunk_cache,
+  VoiceManager& voice_manager,
+  std::string file,
+  int priority,
+  int volume
+) :
+  Component(associated, ComponentType::SoundComponent),
+  priority(priority),
+  voice_manager(&voice_manager),
+  volume(volume)
+{
+  this->open(sound_chunk_cache, file);
+  this->attachToAssociatedGameObject();
+};
+
+Sound::Sound(
+  GameObject& associated,
+  const SoundChunkHandle& sound_chunk_handle,
+  VoiceManager& voice_manager,
+  int priority,
+  int volume
+) :
+  Component(associated, ComponentType::SoundComponent),
+  priority(priority),
+  voice_manager(&voice_manager),
+  volume(volume)
+{
+  this->open(sound_chunk_handle);
+  this->attachToAssociatedGameObject();
+};
+
 Sound::~Sound() noexcept {
   this->stopSoundCurrentlyPlaying();
   this->cleanUpCurrentSound();
@@ -113,12 +158,20 @@ std::string PlaySoundErrorDescription::describeErrorSummary() const noexcept {
 };
 
 bool Sound::finishedPlaying() const noexcept {
+  // A dropped voice never plays, so there is nothing left to wait for.
   return (
-    this->soundStartedPlaying() &&
-    !this->soundIsPlaying()
+    this->voice_dropped || (
+      this->soundStartedPlaying() &&
+      !this->soundIsPlaying()
+    )
   );
 };
 
+bool Sound::finishWillBeReported() const noexcept {
+  // The voice manager hands the associated object back once the voice ends.
+  return this->voice_manager != nullptr && this->soundIsPlaying();
+};
+
 bool Sound::hasReservedChannel() const noexcept {
   return this->channel != -1;
 };
@@ -127,6 +180,21 @@ bool Sound::isOpen() const noexcept {
   return this->sound != nullptr;
 };
 
+void Sound::open(const SoundChunkHandle& sound_chunk_handle) {
+  this->cleanUpCurrentSound();
+
+  // Chunks still loading are opened on the first play after they are ready.
+  if(!sound_chunk_handle.isDone()) {
+    this->pending_chunk = sound_chunk_handle;
+    return;
+  }
+
+  if(sound_chunk_handle.failed())
+    throw OpenSoundException(OpenSoundErrorCode::LoadSoundError);
+
+  this->sound = sound_chunk_handle.get();
+};
+
 void Sound::open(std::string file) {
   this->cleanUpCurrentSound();
 
@@ -134,7 +202,16 @@ void Sound::open(std::string file) {
     throw OpenSoundException(OpenSoundErrorCode::LoadSoundError);
 };
 
+void Sound::open(SoundChunkCache& sound_chunk_cache, std::string file) {
+  this->cleanUpCurrentSound();
+
+  if(this->loadSoundFileFromCache(sound_chunk_cache, file) != 0)
+    throw OpenSoundException(OpenSoundErrorCode::LoadSoundError);
+};
+
 void Sound::play(int loops_after_first_time_played) {
+  this->openPendingChunk();
+
   if(!this->isOpen())
     throw PlaySoundException(PlaySoundErrorCode::PlayUnopenedSoundError);
 
@@ -204,14 +281,28 @@ std::string StopSoundErrorDescription::describeErrorSummary() const noexcept {
 
 // Private method implementations.
 void Sound::cleanUpCurrentSound() noexcept {
-  if(this->isOpen()) {
-    Mix_FreeChunk(this->sound);
-    this->sound = nullptr;
-  }
+  // Shared chunks outlive this sound, so its own channel is halted here.
+  this->stopSoundCurrentlyPlaying();
+  this->pending_chunk = SoundChunkHandle();
+  this->sound.reset();
+  this->voice_dropped = false;
 };
 
 int Sound::loadSoundFile(std::string file) noexcept {
-  this->sound = Mix_LoadWAV(file.c_str());
+  this->sound = SoundChunkCache::loadChunk(file);
+
+  if(this->sound != nullptr)
+    return 0;
+
+  else
+    return -1;
+};
+
+int Sound::loadSoundFileFromCache(
+  SoundChunkCache& sound_chunk_cache,
+  std::string file
+) noexcept {
+  this->sound = sound_chunk_cache.acquire(file);
 
   if(this->sound != nullptr)
     return 0;
@@ -220,32 +311,93 @@ int Sound::loadSoundFile(std::string file) noexcept {
     return -1;
 };
 
+void Sound::openPendingChunk() noexcept {
+  SoundChunkHandle sound_chunk_handle;
+
+  if(!this->pending_chunk.isDone())
+    return;
+
+  sound_chunk_handle = this->pending_chunk;
+  this->pending_chunk = SoundChunkHandle();
+
+  try {
+    this->open(sound_chunk_handle);
+  }
+  catch(std::exception& e) {
+    std::cerr << "[Sound] " << e.what();
+    std::cerr << "[Sound] Ignoring last exception and resuming execution!\n";
+  }
+};
+
 int Sound::playCurrentSoundWithMixer(
   int loops_after_first_time_played
 ) noexcept {
   int auto_assign_channel = -1, assigned_channel;
 
+  if(this->voice_manager != nullptr)
+    return this->playCurrentSoundWithVoiceManager(
+      loops_after_first_time_played
+    );
+
   assigned_channel = Mix_PlayChannel(
     auto_assign_channel,
-    this->sound,
+    this->sound.get(),
     loops_after_first_time_played
   );
 
   if(assigned_channel == -1)
     return -1;
 
+  if((size_t) assigned_channel >= Sound::channel_generations.size())
+    Sound::channel_generations.resize(assigned_channel + 1, 0);
+
   this->channel = assigned_channel;
+  this->voice_generation = ++Sound::channel_generations[assigned_channel];
+  return 0;
+};
+
+int Sound::playCurrentSoundWithVoiceManager(
+  int loops_after_first_time_played
+) noexcept {
+  VoiceHandle voice;
+
+  if(
+    this->voice_manager->play(
+      this->sound.get(),
+      this->priority,
+      this->volume,
+      loops_after_first_time_played,
+      &this->associated,
+      voice
+    ) != 0
+  )
+    return -1;
+
+  this->channel = voice.channel;
+  this->voice_dropped = voice.channel == -1;
+  this->voice_generation = voice.generation;
+
   return 0;
 };
 
 bool Sound::reservedChannelHasNotBeenReassigned() const noexcept {
+  // Merged sounds share a channel, so the chunk alone cannot tell them apart.
+  if(this->voice_manager != nullptr)
+    return this->voiceIsCurrent();
+
+  // The chunk still catches channels played outside of any sound.
   return (
     this->hasReservedChannel() &&
-    Mix_GetChunk(this->channel) == this->sound
+    Sound::channel_generations[this->channel] == this->voice_generation &&
+    Mix_GetChunk(this->channel) == this->sound.get()
   );
 };
 
 bool Sound::reservedChannelIsInUse() const noexcept {
+  // The voice manager already knows, without taking the audio lock.
+  if(this->voice_manager != nullptr)
+    return this->voiceIsCurrent();
+
   return (this->hasReservedChannel() && Mix_Playing(this->channel));
 };
 
@@ -270,6 +422,21 @@ void Sound::stopSoundCurrentlyPlaying() noexcept {
 };
 
 void Sound::stopSoundOnReservedChannel() noexcept {
-  Mix_HaltChannel(this->channel);
+  if(this->voice_manager != nullptr)
+    this->voice_manager->release(
+      {.channel = this->channel, .generation = this->voice_generation},
+      &this->associated
+    );
+
+  else
+    Mix_HaltChannel(this->channel);
+
   this->channel = -1;
 };
+
+bool Sound::voiceIsCurrent() const noexcept {
+  return this->voice_manager->isCurrentVoice({
+    .channel = this->channel,
+    .generation = this->voice_generation
+  });
+};
@@ -0,0 +1,182 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Sound Chunk Cache class - Source code.
+
+// Class header include.
+#include "SoundChunkCache.hpp"
+
+// Class method implementations.
+SoundChunkCache::~SoundChunkCache() noexcept {
+  // Any chunk still playing at this point is halted by its deleter.
+  this->chunks.clear();
+  this->retired_chunks.clear();
+};
+
+// Public method implementations.
+MixChunkSharedPTR SoundChunkCache::acquire(const std::string& file) noexcept {
+  MixChunkSharedPTR chunk;
+  auto cached_entry = this->chunks.find(file);
+
+  if(cached_entry != this->chunks.end()) {
+    this->hit_count++;
+    return cached_entry->second;
+  }
+
+  this->miss_count++;
+  chunk = this->loadCachedChunk(file);
+
+  // Failed loads are not cached, so a later attempt can still succeed.
+  if(chunk)
+    this->chunks.emplace(file, chunk);
+
+  return chunk;
+};
+
+MixChunkSharedPTR SoundChunkCache::acquire(
+  const std::string& file,
+  Mix_Chunk* decoded_chunk
+) noexcept {
+  MixChunkSharedPTR chunk;
+  auto cached_entry = this->chunks.find(file);
+
+  // The cache takes ownership of the decoded chunk, even when it is a dupe.
+  if(cached_entry != this->chunks.end()) {
+    this->hit_count++;
+    Mix_FreeChunk(decoded_chunk);
+    return cached_entry->second;
+  }
+
+  this->miss_count++;
+
+  if(decoded_chunk == nullptr)
+    return MixChunkSharedPTR();
+
+  try {
+    chunk = MixChunkSharedPTR(
+      decoded_chunk,
+      &SoundChunkCache::freeChunkHaltingChannels
+    );
+    this->chunks.emplace(file, chunk);
+  }
+  catch(std::exception& e) {
+    return MixChunkSharedPTR();
+  }
+
+  return chunk;
+};
+
+bool SoundChunkCache::chunkIsPlaying(const Mix_Chunk* chunk) noexcept {
+  int allocated_channels = Mix_AllocateChannels(-1);
+
+  for(int channel = 0; channel < allocated_channels; channel++)
+    if(Mix_Playing(channel) && Mix_GetChunk(channel) == chunk)
+      return true;
+
+  return false;
+};
+
+void SoundChunkCache::clear() noexcept {
+  for(auto& entry : this->chunks)
+    this->retired_chunks.push_back(entry.second);
+
+  this->chunks.clear();
+  this->freeRetiredChunks();
+};
+
+bool SoundChunkCache::contains(const std::string& file) const noexcept {
+  return this->chunks.count(file) != 0;
+};
+
+size_t SoundChunkCache::freeRetiredChunks() noexcept {
+  size_t freed_chunks = 0;
+  auto retired_chunk = this->retired_chunks.begin();
+
+  // A retired chunk is freed only once no channel is playing it anymore.
+  while(retired_chunk != this->retired_chunks.end()) {
+    if(!SoundChunkCache::chunkIsPlaying(retired_chunk->get())) {
+      retired_chunk = this->retired_chunks.erase(retired_chunk);
+      freed_chunks++;
+    }
+    else
+      retired_chunk++;
+  }
+
+  return freed_chunks;
+};
+
+unsigned long SoundChunkCache::getHitCount() const noexcept {
+  return this->hit_count;
+};
+
+unsigned long SoundChunkCache::getMissCount() const noexcept {
+  return this->miss_count;
+};
+
+MixChunkSharedPTR SoundChunkCache::loadChunk(const std::string& file) noexcept {
+  Mix_Chunk* chunk = Mix_LoadWAV(file.c_str());
+
+  if(chunk == nullptr)
+    return MixChunkSharedPTR();
+
+  return MixChunkSharedPTR(chunk, &SoundChunkCache::freeChunkHaltingChannels);
+};
+
+size_t SoundChunkCache::releaseUnusedChunks() noexcept {
+  size_t released_chunks = 0;
+  auto entry = this->chunks.begin();
+
+  // Entries only referenced by the cache itself are no longer in use.
+  while(entry != this->chunks.end()) {
+    if(entry->second.use_count() == 1) {
+      this->retired_chunks.push_back(entry->second);
+      entry = this->chunks.erase(entry);
+      released_chunks++;
+    }
+    else
+      entry++;
+  }
+
+  this->freeRetiredChunks();
+
+  return released_chunks;
+};
+
+void SoundChunkCache::setAssetArchive(
+  const AssetArchive* asset_archive
+) noexcept {
+  // Once set, cache keys are asset ids resolved through the archive.
+  this->asset_archive = asset_archive;
+};
+
+size_t SoundChunkCache::size() const noexcept {
+  return this->chunks.size();
+};
+
+// Private method implementations.
+void SoundChunkCache::freeChunkHaltingChannels(Mix_Chunk* chunk) noexcept {
+  int allocated_channels = Mix_AllocateChannels(-1);
+
+  // Last resort for chunks dropped while audible (e.g. on shutdown).
+  for(int channel = 0; channel < allocated_channels; channel++)
+    if(Mix_GetChunk(channel) == chunk)
+      Mix_HaltChannel(channel);
+
+  Mix_FreeChunk(chunk);
+};
+
+MixChunkSharedPTR SoundChunkCache::loadCachedChunk(
+  const std::string& file
+) const noexcept {
+  Mix_Chunk* chunk;
+
+  if(this->asset_archive == nullptr)
+    return SoundChunkCache::loadChunk(file);
+
+  chunk = Mix_LoadWAV_RW(this->asset_archive->openAsset(file), 1);
+
+  if(chunk == nullptr)
+    return MixChunkSharedPTR();
+
+  return MixChunkSharedPTR(chunk, &SoundChunkCache::freeChunkHaltingChannels);
+};
@@ -0,0 +1,242 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Spatial Grid class - Source code.
+
+// Class header include.
+#include "SpatialGrid.hpp"
+
+// User includes.
+#include "GameObject.hpp"
+
+// Class method implementations.
+SpatialGrid::SpatialGrid(double cell_size) noexcept : cell_size(cell_size) {};
+
+// Public method implementations.
+double SpatialGrid::getMaxStepMotion() const noexcept {
+  return this->max_step_motion;
+};
+
+void SpatialGrid::insert(GameObject* game_object) {
+  GridCellRange cell_range = this->cellRangeCoveredBy(game_object->box);
+
+  this->addToCells(game_object, cell_range);
+  this->indexed_ranges[game_object] = cell_range;
+};
+
+GameObject* SpatialGrid::livingGameObjectWithLeastDepthLocatedAt(
+  const VectorR2& search_coordinates
+) const noexcept {
+  auto cell = this->cells.find(this->cellKeyOf(search_coordinates));
+
+  if(cell == this->cells.end())
+    return nullptr;
+
+  return SpatialGrid::livingGameObjectWithLeastDepthIn(
+    cell->second,
+    search_coordinates
+  );
+};
+
+void SpatialGrid::queryRectangle(
+  const Rectangle& search_area,
+  std::vector<GameObject*>& search_results
+) const {
+  size_t first_result = search_results.size();
+
+  this->queryRectangleUnordered(search_area, search_results);
+
+  // Objects spanning several cells are reported once, in depth order.
+  auto spawned_earlier = [](GameObject* lhs, GameObject* rhs) noexcept {
+    return lhs->getSpawnOrder() < rhs->getSpawnOrder();
+  };
+
+  sort(
+    search_results.begin() + first_result,
+    search_results.end(),
+    spawned_earlier
+  );
+  search_results.erase(
+    unique(search_results.begin() + first_result, search_results.end()),
+    search_results.end()
+  );
+};
+
+void SpatialGrid::queryRectangleUnordered(
+  const Rectangle& search_area,
+  std::vector<GameObject*>& search_results
+) const {
+  GridCellRange cell_range = this->cellRangeCoveredBy(search_area);
+
+  // Objects spanning several cells are reported once per cell they cover.
+  for(long row = cell_range.first_row; row <= cell_range.last_row; row++)
+    for(
+      long column = cell_range.first_column;
+      column <= cell_range.last_column;
+      column++
+    ) {
+      auto cell = this->cells.find(this->cellKey(column, row));
+
+      if(cell == this->cells.end())
+        continue;
+
+      for(GameObject* candidate : cell->second)
+        if(candidate->box.intersectsWith(search_area))
+          search_results.push_back(candidate);
+    }
+};
+
+void SpatialGrid::remove(GameObject* game_object) noexcept {
+  auto indexed_range = this->indexed_ranges.find(game_object);
+
+  if(indexed_range == this->indexed_ranges.end())
+    return;
+
+  this->removeFromCells(game_object, indexed_range->second);
+  this->indexed_ranges.erase(indexed_range);
+};
+
+void SpatialGrid::resetStepMotion() noexcept {
+  this->max_step_motion = 0;
+};
+
+size_t SpatialGrid::size() const noexcept {
+  return this->indexed_ranges.size();
+};
+
+void SpatialGrid::update(GameObject* game_object) {
+  GridCellRange new_range = this->cellRangeCoveredBy(game_object->box);
+  auto indexed_range = this->indexed_ranges.find(game_object);
+
+  if(indexed_range == this->indexed_ranges.end())
+    return;
+
+  this->recordStepMotion(game_object);
+
+  GridCellRange& old_range = indexed_range->second;
+
+  // Most moves stay within the same cells and need no bookkeeping.
+  if(
+    old_range.first_column == new_range.first_column &&
+    old_range.first_row == new_range.first_row &&
+    old_range.last_column == new_range.last_column &&
+    old_range.last_row == new_range.last_row
+  )
+    return;
+
+  this->removeFromCells(game_object, old_range);
+  this->addToCells(game_object, new_range);
+  old_range = new_range;
+};
+
+// Private method implementations.
+void SpatialGrid::addToCells(
+  GameObject* game_object,
+  const GridCellRange& cell_range
+) {
+  for(long row = cell_range.first_row; row <= cell_range.last_row; row++)
+    for(
+      long column = cell_range.first_column;
+      column <= cell_range.last_column;
+      column++
+    )
+      this->cells[this->cellKey(column, row)].push_back(game_object);
+};
+
+long long SpatialGrid::cellKey(long column, long row) const noexcept {
+  // Shifted unsigned, since shifting a negative column is undefined.
+  return (long long) (((unsigned long long) column) << 32) ^ \
+    (row & 0xFFFFFFFFLL);
+};
+
+GridCellRange SpatialGrid::cellRangeCoveredBy(
+  const Rectangle& area
+) const noexcept {
+  return {
+    .first_column = this->cellIndexOf(area.upper_left_corner.x),
+    .first_row = this->cellIndexOf(area.upper_left_corner.y),
+    .last_column = this->cellIndexOf(area.upper_left_corner.x + area.width),
+    .last_row = this->cellIndexOf(area.upper_left_corner.y + area.height)
+  };
+};
+
+long SpatialGrid::cellIndexOf(double coordinate) const noexcept {
+  return (long) floor(coordinate / this->cell_size);
+};
+
+long long SpatialGrid::cellKeyOf(const VectorR2& coordinates) const noexcept {
+  return this->cellKey(
+    this->cellIndexOf(coordinates.x),
+    this->cellIndexOf(coordinates.y)
+  );
+};
+
+void SpatialGrid::recordStepMotion(const GameObject* game_object) noexcept {
+  const Rectangle& box = game_object->box;
+  Rectangle swept_box = game_object->sweptBox();
+
+  // The widest overhang on any side bounds how far queries must reach out.
+  this->max_step_motion = std::max({
+    this->max_step_motion,
+    box.upper_left_corner.x - swept_box.upper_left_corner.x,
+    box.upper_left_corner.y - swept_box.upper_left_corner.y,
+    (swept_box.upper_left_corner.x + swept_box.width) - \
+      (box.upper_left_corner.x + box.width),
+    (swept_box.upper_left_corner.y + swept_box.height) - \
+      (box.upper_left_corner.y + box.height)
+  });
+};
+
+void SpatialGrid::removeFromCells(
+  GameObject* game_object,
+  const GridCellRange& cell_range
+) noexcept {
+  for(long row = cell_range.first_row; row <= cell_range.last_row; row++)
+    for(
+      long column = cell_range.first_column;
+      column <= cell_range.last_column;
+      column++
+    ) {
+      auto cell = this->cells.find(this->cellKey(column, row));
+
+      if(cell == this->cells.end())
+        continue;
+
+      std::vector<GameObject*>& cell_contents = cell->second;
+      auto position = find(
+        cell_contents.begin(),
+        cell_contents.end(),
+        game_object
+      );
+
+      if(position != cell_contents.end()) {
+        *position = cell_contents.back();
+        cell_contents.pop_back();
+      }
+
+      if(cell_contents.empty())
+        this->cells.erase(cell);
+    }
+};
+
+GameObject* SpatialGrid::livingGameObjectWithLeastDepthIn(
+  const std::vector<GameObject*>& cell_contents,
+  const VectorR2& search_coordinates
+) noexcept {
+  GameObject* search_result = nullptr;
+
+  // Later spawns are drawn on top, so they have the least depth.
+  for(GameObject* candidate : cell_contents)
+    if(
+      candidate->isAlive() &&
+      !candidate->deathWasRecorded() &&
+      candidate->box.isReferenceInsideOfSelf(search_coordinates) &&
+      (
+        search_result == nullptr ||
+        candidate->getSpawnOrder() > search_result->getSpawnOrder()
+      )
+    )
+      search_result = candidate;
+
+  return search_result;
+};
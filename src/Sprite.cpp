@@ -13,6 +13,14 @@ Sprite::Sprite(
   this->attachToAssociatedGameObject();
 };
 
+Sprite::Sprite(
+  GameObject& associated,
+  const TextureHandle& texture_handle
+) : Component(associated, ComponentType::SpriteComponent) {
+  this->open(texture_handle);
+  this->attachToAssociatedGameObject();
+};
+
 Sprite::Sprite(
   GameObject& associated,
   SDL_Renderer* renderer,
@@ -22,6 +30,16 @@ Sprite::Sprite(
   this->attachToAssociatedGameObject();
 };
 
+Sprite::Sprite(
+  GameObject& associated,
+  TextureCache& texture_cache,
+  SDL_Renderer* renderer,
+  std::string file
+) : Component(associated, ComponentType::SpriteComponent) {
+  this->open(texture_cache, renderer, file);
+  this->attachToAssociatedGameObject();
+};
+
 // Public method implementations.
 std::string OpenSpriteErrorDescription::describeErrorCause(
   OpenSpriteErrorCode error_code
@@ -67,6 +85,25 @@ std::string OpenSpriteErrorDescription::describeErrorSummary() const noexcept {
   return error_summary;
 };
 
+void Sprite::appendToBatch(SpriteBatch& sprite_batch) const {
+  const Rectangle& render_box = this->associated.getRenderBox();
+  SDL_FRect destination_rect = {
+    .x = (float) (int) render_box.upper_left_corner.x,
+    .y = (float) (int) render_box.upper_left_corner.y,
+    .w = (float) this->clip_rect.w,
+    .h = (float) this->clip_rect.h
+  };
+
+  if(!this->isOpen())
+    return;
+
+  sprite_batch.addSprite(
+    this->texture.get(),
+    this->sourceRectInTexture(),
+    destination_rect
+  );
+};
+
 int Sprite::getHeight() const noexcept {
   return this->height;
 };
@@ -75,30 +112,81 @@ int Sprite::getWidth() const noexcept {
   return this->width;
 };
 
+bool Sprite::hasPendingTexture() const noexcept {
+  return this->pending_texture.isValid();
+};
+
 bool Sprite::isOpen() const noexcept {
   return (this->texture.get() != nullptr);
 };
 
+void Sprite::open(const TextureHandle& texture_handle) {
+  // Textures still loading are opened by the owner once they are ready.
+  if(!texture_handle.isDone()) {
+    this->pending_texture = texture_handle;
+    return;
+  }
+
+  if(texture_handle.failed())
+    throw OpenSpriteException(OpenSpriteErrorCode::LoadSpriteTextureError);
+
+  this->useTextureRegion(texture_handle.get());
+  this->configureOpenedTexture();
+};
+
 void Sprite::open(SDL_Renderer* renderer, std::string file) {
   if(this->loadSpriteTexture(renderer, file) != 0)
     throw OpenSpriteException(OpenSpriteErrorCode::LoadSpriteTextureError);
-  
-  if(this->configSpriteWithTextureSpecs() != 0)
-    throw OpenSpriteException(OpenSpriteErrorCode::ConfigureSpriteError);
+
+  this->configureOpenedTexture();
+};
+
+void Sprite::open(
+  TextureCache& texture_cache,
+  SDL_Renderer* renderer,
+  std::string file
+) {
+  if(this->loadSpriteTextureFromCache(texture_cache, renderer, file) != 0)
+    throw OpenSpriteException(OpenSpriteErrorCode::LoadSpriteTextureError);
+
+  this->configureOpenedTexture();
+};
+
+void Sprite::openPendingTexture() noexcept {
+  TextureHandle texture_handle;
+
+  if(!this->pending_texture.isDone())
+    return;
+
+  texture_handle = this->pending_texture;
+  this->pending_texture = TextureHandle();
+
+  try {
+    this->open(texture_handle);
+  }
+  catch(std::exception& e) {
+    std::cerr << "[Sprite] " << e.what();
+    std::cerr << "[Sprite] Ignoring last exception and resuming execution!\n";
+  }
 };
 
 void Sprite::render(SDL_Renderer* renderer) noexcept {
+  const Rectangle& render_box = this->associated.getRenderBox();
+  SDL_Rect source_rect = this->sourceRectInTexture();
   SDL_Rect destination_rect = {
-    .x = (int) this->associated.box.upper_left_corner.x,
-    .y = (int) this->associated.box.upper_left_corner.y,
+    .x = (int) render_box.upper_left_corner.x,
+    .y = (int) render_box.upper_left_corner.y,
     .w = this->clip_rect.w,
     .h = this->clip_rect.h
   };
 
+  if(!this->isOpen())
+    return;
+
   SDL_RenderCopy(
     renderer,
     this->texture.get(),
-    &this->clip_rect,
+    &source_rect,
     &destination_rect
   );
 };
@@ -112,17 +200,14 @@ void Sprite::setClip(int x_pos, int y_pos, int width, int height) noexcept {
 
 void Sprite::update(double dt) noexcept {};
 
+
 // Private method implementations.
 int Sprite::configSpriteWithTextureSpecs() noexcept {
-  if(
-    SDL_QueryTexture(
-      this->texture.get(),
-      nullptr,
-      nullptr,
-      &this->width,
-      &this->height
-    ) != 0
-  )
+  // Atlas textures hold many images, so the size comes from the region.
+  this->width = this->texture_region.w;
+  this->height = this->texture_region.h;
+
+  if(this->width <= 0 || this->height <= 0)
     return -1;
 
   this->setClip(0, 0, this->width, this->height);
@@ -134,11 +219,16 @@ int Sprite::configSpriteWithTextureSpecs() noexcept {
   return 0;
 };
 
+void Sprite::configureOpenedTexture() {
+  if(this->configSpriteWithTextureSpecs() != 0)
+    throw OpenSpriteException(OpenSpriteErrorCode::ConfigureSpriteError);
+};
+
 int Sprite::loadSpriteTexture(
   SDL_Renderer* renderer,
   std::string file
 ) noexcept {
-  this->texture.reset(IMG_LoadTexture(renderer, file.c_str()));
+  this->useTextureRegion(TextureCache::loadTexture(renderer, file));
   
   if(this->texture)
     return 0;
@@ -146,3 +236,31 @@ int Sprite::loadSpriteTexture(
   else
     return -1;
 };
+
+int Sprite::loadSpriteTextureFromCache(
+  TextureCache& texture_cache,
+  SDL_Renderer* renderer,
+  std::string file
+) noexcept {
+  this->useTextureRegion(texture_cache.acquire(renderer, file));
+
+  if(this->texture)
+    return 0;
+
+  else
+    return -1;
+};
+
+SDL_Rect Sprite::sourceRectInTexture() const noexcept {
+  return {
+    .x = this->texture_region.x + this->clip_rect.x,
+    .y = this->texture_region.y + this->clip_rect.y,
+    .w = this->clip_rect.w,
+    .h = this->clip_rect.h
+  };
+};
+
+void Sprite::useTextureRegion(const TextureRegion& texture_region) noexcept {
+  this->texture = texture_region.texture;
+  this->texture_region = texture_region.region;
+};
@@ -0,0 +1,127 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Sprite Batch class - Source code.
+
+// Class header include.
+#include "SpriteBatch.hpp"
+
+// Class method implementations.
+SpriteBatch::SpriteBatch() {
+  this->vertices.reserve(4 * SPRITE_BATCH_INITIAL_CAPACITY);
+  this->indices.reserve(6 * SPRITE_BATCH_INITIAL_CAPACITY);
+};
+
+// Public method implementations.
+void SpriteBatch::addSprite(
+  SDL_Texture* texture,
+  const SDL_Rect& source_rect,
+  const SDL_FRect& destination_rect
+) {
+  SDL_Color white = {.r = 255, .g = 255, .b = 255, .a = 255};
+  int first_vertex = (int) this->vertices.size();
+  float left, right, top, bottom;
+
+  // A texture change ends the batch, so sprites keep their depth order.
+  if(texture != this->batch_texture)
+    this->switchToTexture(texture);
+
+  left = (float) source_rect.x / this->batch_texture_width;
+  right = (float) (source_rect.x + source_rect.w) / this->batch_texture_width;
+  top = (float) source_rect.y / this->batch_texture_height;
+  bottom = (float) (source_rect.y + source_rect.h) / this->batch_texture_height;
+
+  this->vertices.push_back({
+    .position = {.x = destination_rect.x, .y = destination_rect.y},
+    .color = white,
+    .tex_coord = {.x = left, .y = top}
+  });
+  this->vertices.push_back({
+    .position = {
+      .x = destination_rect.x + destination_rect.w,
+      .y = destination_rect.y
+    },
+    .color = white,
+    .tex_coord = {.x = right, .y = top}
+  });
+  this->vertices.push_back({
+    .position = {
+      .x = destination_rect.x + destination_rect.w,
+      .y = destination_rect.y + destination_rect.h
+    },
+    .color = white,
+    .tex_coord = {.x = right, .y = bottom}
+  });
+  this->vertices.push_back({
+    .position = {
+      .x = destination_rect.x,
+      .y = destination_rect.y + destination_rect.h
+    },
+    .color = white,
+    .tex_coord = {.x = left, .y = bottom}
+  });
+
+  for(int corner : {0, 1, 2, 0, 2, 3})
+    this->indices.push_back(first_vertex + corner);
+
+  this->sprite_count++;
+};
+
+void SpriteBatch::begin(SDL_Renderer* renderer) noexcept {
+  this->renderer = renderer;
+  this->batch_texture = nullptr;
+  this->draw_call_count = 0;
+  this->sprite_count = 0;
+  this->vertices.clear();
+  this->indices.clear();
+};
+
+void SpriteBatch::end() noexcept {
+  this->flush();
+  this->batch_texture = nullptr;
+};
+
+void SpriteBatch::flush() noexcept {
+  if(this->indices.empty())
+    return;
+
+  SDL_RenderGeometry(
+    this->renderer,
+    this->batch_texture,
+    this->vertices.data(),
+    (int) this->vertices.size(),
+    this->indices.data(),
+    (int) this->indices.size()
+  );
+
+  this->draw_call_count++;
+  this->vertices.clear();
+  this->indices.clear();
+};
+
+unsigned long SpriteBatch::getDrawCallCount() const noexcept {
+  return this->draw_call_count;
+};
+
+unsigned long SpriteBatch::getSpriteCount() const noexcept {
+  return this->sprite_count;
+};
+
+// Private method implementations.
+void SpriteBatch::switchToTexture(SDL_Texture* texture) noexcept {
+  this->flush();
+  this->batch_texture = texture;
+
+  if(
+    SDL_QueryTexture(
+      texture,
+      nullptr,
+      nullptr,
+      &this->batch_texture_width,
+      &this->batch_texture_height
+    ) != 0
+  ) {
+    this->batch_texture_width = 1;
+    this->batch_texture_height = 1;
+  }
+};
@@ -7,42 +7,162 @@
 #include "State.hpp"
 
 // Class method implementations.
-State::State(SDL_Renderer* renderer) :
-  music(STATE_MUSIC_FILE),
+State::State(SDL_Renderer* renderer, JobSystem& job_system) :
+  asset_manifest(STATE_ASSET_MANIFEST_FILE),
+  asset_archive(asset_manifest),
+  asset_loader(asset_archive, texture_cache, sound_chunk_cache),
+  job_system(job_system),
+  music_manager(asset_loader),
   renderer(renderer)
 {
-  this->addBackgroundGameObject({
-    .sprite_file = BACKGROUND_SPRITE_FILE
-  });
-  this->playMusic();
+  this->openAssetArchive();
+  this->subscribeToInput();
+
+  // Nothing here blocks on a load, so the first frame is not held back.
+  this->loadAssets();
+  this->addBackgroundGameObject({.sprite_id = BACKGROUND_SPRITE_ID});
 };
 
 // Public method implementations.
-void State::loadAssets() {};
+void State::clickAt(const VectorR2& click_coordinates) {
+  GameObject* game_object_clicked_on;
+
+  game_object_clicked_on = this->livingGameObjectWithLeastDepthLocatedAt(
+    click_coordinates
+  );
+  
+  this->handleClickOnGameObject(game_object_clicked_on);
+};
+
+size_t State::countGameObjects() const noexcept {
+  return this->objectArray.size();
+};
+
+size_t State::countPendingCommands() const noexcept {
+  return this->command_buffer.countPendingCommands();
+};
+
+double State::getAssetLoadTime() const noexcept {
+  return this->asset_load_time;
+};
+
+const CollisionStatistics& State::getCollisionStatistics() const noexcept {
+  return this->collision_system.getStatistics();
+};
+
+ComponentStorageMode State::getComponentStorageMode() const noexcept {
+  return this->component_storage_mode;
+};
+
+const InputLatencyStatistics& State::getInputLatencyStatistics(
+  InputEventType type
+) const noexcept {
+  return this->input_manager.getLatencyStatistics(type);
+};
+
+double State::getLoadingProgress() const noexcept {
+  unsigned long requested_loads = this->asset_loader.getRequestedLoadCount();
+
+  if(requested_loads == 0)
+    return 1;
+
+  return (double) this->asset_loader.getCompletedLoadCount() / requested_loads;
+};
+
+const MusicStatistics& State::getMusicStatistics() const noexcept {
+  return this->music_manager.getStatistics();
+};
+
+const RenderStatistics& State::getRenderStatistics() const noexcept {
+  return this->render_statistics;
+};
+
+const SoundChunkCache& State::getSoundChunkCache() const noexcept {
+  return this->sound_chunk_cache;
+};
+
+const TextureCache& State::getTextureCache() const noexcept {
+  return this->texture_cache;
+};
+
+const VoiceStatistics& State::getVoiceStatistics() const noexcept {
+  return this->voice_manager.getStatistics();
+};
+
+void State::loadAssets() {
+  this->asset_load_start_counter = SDL_GetPerformanceCounter();
+
+  // Warm the caches off the main thread, so later spawns hit them instead.
+  this->asset_loader.requestManifestAssets(
+    this->asset_manifest,
+    this->renderer
+  );
+  this->music_manager.play(STATE_MUSIC_ID, 0);
+};
+
+void State::playMusic(
+  const std::string& id,
+  unsigned int crossfade_duration_milliseconds
+) {
+  this->music_manager.play(id, crossfade_duration_milliseconds);
+};
 
 void State::processInput() {
-  SDL_Event event;
-  VectorR2 mouse_coordinates = this->mouseCoordinates();
+  PROFILE_SCOPE("State::processInput");
 
-  while(SDL_PollEvent(&event))
-    this->handleEvent(event, mouse_coordinates);
+  this->input_manager.pollEvents();
 };
 
 bool State::quitRequested() const noexcept {
   return this->quit_requested;
 };
 
-void State::renderAndPresent() {
+void State::renderAndPresent(double interpolation_factor) {
+  this->pollAssetLoading();
+
   SDL_RenderClear(this->renderer);
-  this->renderGameObjects();
+  this->renderGameObjects(interpolation_factor);
+
+  if(!this->assets_loaded)
+    this->renderLoadingBar();
+
+  if(this->profiler_overlay_visible)
+    Profiler::renderOverlay(this->renderer);
+
   SDL_RenderPresent(this->renderer);
+  this->input_manager.markFramePresented();
+};
+
+void State::setComponentStorageMode(
+  ComponentStorageMode storage_mode
+) noexcept {
+  this->component_storage_mode = storage_mode;
+};
+
+void State::setMusicCacheCapacity(size_t cache_capacity) noexcept {
+  this->music_manager.setCacheCapacity(cache_capacity);
+};
+
+void State::setPreserveDepthOrder(bool preserve_depth_order) noexcept {
+  this->preserve_depth_order = preserve_depth_order;
+};
+
+void State::spawnEnemyAt(const VectorR2& spawn_coordinates) {
+  this->addEnemyGameObject({
+    .sprite_id = ENEMY_SPRITE_ID,
+    .sound_id = ENEMY_SOUND_ID,
+    .coordinates = spawn_coordinates
+  });
 };
 
 void State::update(double dt) {
+  // Sounds started during one step may share a voice, never across steps.
+  this->voice_manager.advanceFrame();
   this->processInput();
   this->updateGameObjects(dt);
-  this->requestDeletionOfGameObjectsAptForDeletion();
-  this->removeGameObjectsWhoseDeletionWasRequested();
+  this->resolveCollisions();
+  this->flushCommandBuffer();
+  this->removeGameObjectsAptForDeletion();
 };
 
 // Private method implementations.
@@ -53,175 +173,336 @@ void State::addBackgroundGameObject(
 
   this->addGameObject(background_object);
 
+  // The background shows up once its texture finishes loading.
   new Sprite(
     *background_object,
-    this->renderer,
-    background_params.sprite_file
+    this->asset_loader.requestTexture(
+      this->renderer,
+      background_params.sprite_id
+    )
   );
+  this->watchPendingSprite(background_object);
 };
 
 void State::addEnemyGameObject(const EnemyParams& enemy_params) {
-  GameObject *enemy_object = new GameObject();
-  
-  this->addGameObject(enemy_object);
-
-  new Face(*enemy_object);
-  new Sound(*enemy_object, enemy_params.sound_file);
-  new Sprite(*enemy_object, this->renderer, enemy_params.sprite_file);
-
-  enemy_object->setCenterCoordinates(enemy_params.coordinates);
+  // Enemies join at the next flush, so no update sees the array grow.
+  this->command_buffer.spawn(
+    [this, enemy_params](GameObject& enemy_object) {
+      new Collider(enemy_object);
+      new Face(enemy_object);
+      new Sound(
+        enemy_object,
+        this->asset_loader.requestSoundChunk(enemy_params.sound_id),
+        this->voice_manager
+      );
+      new Sprite(
+        enemy_object,
+        this->asset_loader.requestTexture(
+          this->renderer,
+          enemy_params.sprite_id
+        )
+      );
+
+      enemy_object.setCenterCoordinates(enemy_params.coordinates);
+
+      // The spawner adopted the object before this factory gave it a sprite.
+      this->watchPendingSprite(&enemy_object, true);
+    }
+  );
 };
 
 void State::addGameObject(GameObject* new_game_object) {
   this->objectArray.emplace_back(std::unique_ptr<GameObject>(new_game_object));
+
+  // Spawn order doubles as depth order, since objects are drawn in sequence.
+  new_game_object->setSpawnOrder(this->next_spawn_order++);
+  new_game_object->attachToSpatialIndex(&this->spatial_index);
+  new_game_object->attachToComponentRegistry(&this->component_registry);
+  new_game_object->attachToCommandBuffer(&this->command_buffer);
 };
 
 int State::applyDamageToGameObject(
-  std::unique_ptr<GameObject>& damage_target,
+  GameObject& damage_target,
   unsigned int damage
 ) {
-  Face* target_face_component;
+  Face* target_face_component = damage_target.getComponent<Face>();
+  bool death_was_recorded = damage_target.deathWasRecorded();
 
-  if(!damage_target->hasComponentType(ComponentType::FaceComponent))
+  if(target_face_component == nullptr)
     return -1;
 
-  target_face_component = static_cast<Face*>(
-    damage_target->getComponent(ComponentType::FaceComponent)
-  );
   target_face_component->registerDamage(damage);
-  
+
+  // Deaths no voice reports back on have nothing left to wait for.
+  if(
+    !death_was_recorded &&
+    damage_target.deathWasRecorded() &&
+    !this->gameObjectWaitsOnDeathSound(damage_target)
+  )
+    this->finished_dying_game_objects.push_back(&damage_target);
+
   return 0;
 };
 
-game_object_iter State::convertReverseIterToIter(
-  game_object_reverse_iter reverse_iterator
-) const {
-  return (reverse_iterator + 1).base();
+void State::flushCommandBuffer() {
+  PROFILE_SCOPE("State::flushCommandBuffer");
+
+  // The one sync point where the object array and components may change.
+  this->command_buffer.flush(
+    [this](GameObject* spawned_game_object) {
+      this->addGameObject(spawned_game_object);
+    }
+  );
 };
 
-bool State::gameObjectFinishedPlayingDeathSound(
+bool State::forgetGameObjectIfDeletionWasRequested(
   std::unique_ptr<GameObject>& game_object
-) const noexcept {
-  Sound* game_object_sound_component;
+) noexcept {
+  if(!game_object->deletionWasRequested())
+    return false;
+
+  // Only objects spawned while loading can still wait on a sprite texture.
+  auto watches_game_object = [&game_object](
+    const PendingSpriteObject& pending_sprite_object
+  ) noexcept {
+    return pending_sprite_object.game_object == game_object.get();
+  };
 
-  if(game_object->hasComponentType(ComponentType::SoundComponent)) {
-    game_object_sound_component = static_cast<Sound*>(
-      game_object->getComponent(ComponentType::SoundComponent)
+  if(!this->pending_sprite_objects.empty())
+    this->pending_sprite_objects.erase(
+      remove_if(
+        this->pending_sprite_objects.begin(),
+        this->pending_sprite_objects.end(),
+        watches_game_object
+      ),
+      this->pending_sprite_objects.end()
     );
 
-    return game_object_sound_component->finishedPlaying();
-  }
-
-  else
-    return true;
+  return true;
 };
 
-bool State::gameObjectIsAptForDeletion(
-  std::unique_ptr<GameObject>& game_object
+bool State::gameObjectWaitsOnDeathSound(
+  GameObject& game_object
 ) const noexcept {
-  return(
-    game_object->getState() == GameObjectState::DeadState &&
-    this->gameObjectFinishedPlayingDeathSound(game_object)
+  Sound* game_object_sound_component = game_object.getComponent<Sound>();
+
+  return (
+    game_object_sound_component != nullptr &&
+    game_object_sound_component->finishWillBeReported()
   );
 };
 
-void State::handleClickOnGameObject(game_object_iter target_iter) {
-  if((*target_iter)->hasComponentType(ComponentType::FaceComponent))
+void State::handleClickOnGameObject(GameObject* target) {
+  if(
+    target != nullptr &&
+    target->hasComponentType(ComponentType::FaceComponent)
+  )
     this->applyDamageToGameObject(
-      *target_iter,
+      *target,
       100
     );
 };
 
-void State::handleEvent(
-  const SDL_Event& event,
-  const VectorR2& mouse_coordinates
-) {
-  switch (event.type) {
-    case SDL_KEYDOWN:
-      this->handleKeyDown(event.key.keysym, mouse_coordinates);
-      break;
-
-    case SDL_MOUSEBUTTONDOWN:
-      this->handleMouseButtonDown(mouse_coordinates);
-      break;
-
-    case SDL_QUIT:
-      this->quit_requested = true;
-      break;
-  }
-};
-
 void State::handleKeyDown(
   const SDL_Keysym& keysym,
   const VectorR2& mouse_coordinates
 ) {
   switch (keysym.sym) {
     case SDLK_e:
-      this->addEnemyGameObject({
-        .sprite_file = ENEMY_SPRITE_FILE,
-        .sound_file = ENEMY_SOUND_FILE,
-        .coordinates = mouse_coordinates
-      });
+      this->spawnEnemyAt(mouse_coordinates);
       break;
 
     case SDLK_ESCAPE:
       this->quit_requested = true;
       break;
+
+// Without profiling there are no samples to show nor to export.
+#ifdef ENABLE_PROFILING
+    case SDLK_F3:
+      this->profiler_overlay_visible = !this->profiler_overlay_visible;
+      break;
+
+    case SDLK_F4:
+      if(Profiler::exportChromeTrace() != 0)
+        std::cerr << "[State] Failed to export the profiler trace!\n";
+      break;
+#endif
   }
 };
 
-void State::handleMouseButtonDown(const VectorR2& mouse_coordinates) {
-  game_object_iter game_object_clicked_on;
-
-  game_object_clicked_on = this->livingGameObjectWithLeastDepthLocatedAt(
-    mouse_coordinates
-  );
-  
-  this->handleClickOnGameObject(game_object_clicked_on);
+void State::handleKeyDownEvents(const std::vector<InputEvent>& events) {
+  for(const InputEvent& event : events)
+    this->handleKeyDown(event.keysym, event.coordinates);
 };
 
-game_object_iter State::livingGameObjectWithLeastDepthLocatedAt(
-  const VectorR2& search_coordinates
+void State::handleMouseButtonDownEvents(
+  const std::vector<InputEvent>& events
 ) {
-  game_object_reverse_iter search_result_reverse_iter;
+  // Picked one at a time, so a click after a kill reaches the enemy below.
+  for(const InputEvent& event : events)
+    this->clickAt(event.coordinates);
+};
 
-  auto coordinates_are_inside_of_living_game_object = [&search_coordinates](
-    const std::unique_ptr<GameObject>& game_object
-  ) {
-    return (
-      game_object->isAlive() &&
-      game_object->box.isReferenceInsideOfSelf(search_coordinates)
-    );
-  };
+void State::handleQuitEvents(const std::vector<InputEvent>& events) noexcept {
+  this->quit_requested = true;
+};
 
-  search_result_reverse_iter = find_if(
-    this->objectArray.rbegin(),
-    this->objectArray.rend(),
-    coordinates_are_inside_of_living_game_object
+GameObject* State::livingGameObjectWithLeastDepthLocatedAt(
+  const VectorR2& search_coordinates
+) const noexcept {
+  return this->spatial_index.livingGameObjectWithLeastDepthLocatedAt(
+    search_coordinates
   );
+};
 
-  return this->convertReverseIterToIter(search_result_reverse_iter);
+unsigned long State::markGameObjectsInsideViewport(const Rectangle& viewport) {
+  // The grid only pays off once scanning every box costs more than a query.
+  if(this->objectArray.size() >= CULLING_SPATIAL_INDEX_THRESHOLD)
+    return this->markGameObjectsInsideViewportWithSpatialIndex(viewport);
+  else
+    return this->markGameObjectsInsideViewportWithAABBTest(viewport);
 };
 
-VectorR2 State::mouseCoordinates() const noexcept {
-  int mouseX, mouseY;
+unsigned long State::markGameObjectsInsideViewportWithAABBTest(
+  const Rectangle& viewport
+) {
+  size_t object_count = this->objectArray.size();
+
+  this->visibility_test_boxes.resize(4 * object_count);
+  this->visibility_flags.resize(object_count);
+
+  float* lefts = this->visibility_test_boxes.data();
+  float* tops = lefts + object_count;
+  float* rights = tops + object_count;
+  float* bottoms = rights + object_count;
+  unsigned char* flags = this->visibility_flags.data();
+  unsigned long visible_objects;
+
+  // Gather the boxes as structure of arrays, so they are tested in batches.
+  // Swept boxes keep objects interpolating in from offscreen from popping.
+  for(size_t index = 0; index < object_count; index++) {
+    Rectangle box = this->objectArray[index]->sweptBox();
+
+    lefts[index] = (float) box.upper_left_corner.x;
+    tops[index] = (float) box.upper_left_corner.y;
+    rights[index] = (float) (box.upper_left_corner.x + box.width);
+    bottoms[index] = (float) (box.upper_left_corner.y + box.height);
+  }
 
-  SDL_GetMouseState(&mouseX, &mouseY);
+  visible_objects = VectorBatch::markIntersectingRectangle(
+    lefts,
+    tops,
+    rights,
+    bottoms,
+    object_count,
+    Rectanglef(viewport),
+    flags
+  );
+
+  for(size_t index = 0; index < object_count; index++)
+    if(flags[index])
+      this->objectArray[index]->markVisibleInFrame(this->visibility_frame);
 
-  return VectorR2((double) mouseX, (double) mouseY);
+  return visible_objects;
 };
 
-void State::playMusic() noexcept {
+unsigned long State::markGameObjectsInsideViewportWithSpatialIndex(
+  const Rectangle& viewport
+) {
+  double margin = this->spatial_index.getMaxStepMotion();
+  unsigned long visible_objects = 0;
+
+  // Widened by this step's motion, so objects sliding in are candidates too.
+  this->visible_game_objects.clear();
+  this->spatial_index.queryRectangleUnordered(
+    Rectangle(
+      viewport.upper_left_corner - VectorR2(margin, margin),
+      viewport.width + 2 * margin,
+      viewport.height + 2 * margin
+    ),
+    this->visible_game_objects
+  );
+
+  // The visibility mark drops the duplicates of objects spanning cells.
+  for(GameObject* game_object : this->visible_game_objects)
+    if(
+      !game_object->isVisibleInFrame(this->visibility_frame) &&
+      game_object->sweptBox().intersectsWith(viewport)
+    ) {
+      game_object->markVisibleInFrame(this->visibility_frame);
+      visible_objects++;
+    }
+
+  return visible_objects;
+};
+
+void State::openAssetArchive() noexcept {
+  // Caches key assets by id from here on, whether packed or loose.
+  this->texture_cache.setAssetArchive(&this->asset_archive);
+  this->sound_chunk_cache.setAssetArchive(&this->asset_archive);
+
   try {
-    this->music.play();
+    this->asset_archive.open(STATE_ASSET_ARCHIVE_FILE);
   }
-  catch(PlayMusicException& play_music_exception) {
-    std::cerr << "[State] " << play_music_exception.what();
-    std::cerr << "[State] Ignoring last exception and resuming execution!\n";
+  catch(AssetArchiveException& e) {
+    std::cerr << "[State] " << e.what();
+    std::cerr << "[State] Loading loose asset files instead!\n";
   }
 };
 
+void State::openPendingSprites() noexcept {
+  auto sprite_texture_was_opened = [](
+    const PendingSpriteObject& pending_sprite_object
+  ) noexcept {
+    GameObject& game_object = *pending_sprite_object.game_object;
+    Sprite* sprite = game_object.getComponent<Sprite>();
+    VectorR2 center_coordinates = game_object.box.coordinatesOfCenter();
+
+    if(sprite == nullptr)
+      return true;
+
+    sprite->openPendingTexture();
+
+    if(sprite->hasPendingTexture())
+      return false;
+
+    if(pending_sprite_object.keeps_center)
+      game_object.setCenterCoordinates(center_coordinates);
+
+    return true;
+  };
+
+  this->pending_sprite_objects.erase(
+    remove_if(
+      this->pending_sprite_objects.begin(),
+      this->pending_sprite_objects.end(),
+      sprite_texture_was_opened
+    ),
+    this->pending_sprite_objects.end()
+  );
+};
+
+void State::pollAssetLoading() noexcept {
+  this->asset_loader.uploadDecodedAssets(ASSET_LOADER_FRAME_UPLOAD_BUDGET);
+  this->openPendingSprites();
+
+  this->music_manager.update();
+
+  if(this->assets_loaded || this->asset_loader.countPendingLoads() != 0)
+    return;
+
+  this->assets_loaded = true;
+  this->asset_load_time = (double) (
+    SDL_GetPerformanceCounter() - this->asset_load_start_counter
+  ) / SDL_GetPerformanceFrequency();
+
+// Read through getAssetLoadTime otherwise, so release runs stay quiet.
+#ifdef ENABLE_PROFILING
+  std::cout << "[State] Loaded " << this->asset_manifest.size()
+    << " manifest assets in " << 1000 * this->asset_load_time << " ms.\n";
+#endif
+};
+
 VectorR2 State::randomCoordinatesWithMagnitude(
   unsigned int coordinates_magnitude
 ) const noexcept {
@@ -231,46 +512,242 @@ VectorR2 State::randomCoordinatesWithMagnitude(
     .clockwiseRotatedVector(random_angle);
 };
 
-void State::removeGameObjectAt(size_t index) {
-  if(index < this->objectArray.size())
-    this->objectArray.erase(std::next(this->objectArray.begin(), index));
+void State::removeGameObjectsAptForDeletion() {
+  PROFILE_SCOPE("State::removeGameObjectsAptForDeletion");
+
+  this->requestDeletionOfGameObjectsDoneDying();
+
+  // Draw order is depth order, so only reorder when told it is safe to.
+  if(this->preserve_depth_order)
+    this->removeGameObjectsAptForDeletionPreservingOrder();
+  else
+    this->removeGameObjectsAptForDeletionWithSwapAndPop();
 };
 
-void State::removeGameObjectsWhoseDeletionWasRequested() {
-  unsigned int index = 0;
+void State::removeGameObjectsAptForDeletionPreservingOrder() {
+  size_t write_index = 0;
+
+  // Single pass: each object is checked and either kept or freed in place,
+  // survivors slide down in order and the tail is erased at once.
+  for(
+    size_t read_index = 0;
+    read_index < this->objectArray.size();
+    read_index++
+  ) {
+    if(
+      this->forgetGameObjectIfDeletionWasRequested(
+        this->objectArray[read_index]
+      )
+    ) {
+      this->objectArray[read_index].reset();
+      continue;
+    }
+
+    if(write_index != read_index)
+      this->objectArray[write_index] = std::move(
+        this->objectArray[read_index]
+      );
+
+    write_index++;
+  }
+
+  this->objectArray.erase(
+    this->objectArray.begin() + write_index,
+    this->objectArray.end()
+  );
+};
+
+void State::removeGameObjectsAptForDeletionWithSwapAndPop() {
+  size_t index = 0;
+  unsigned long freed_spawn_order;
 
-  // Use numerical indexes because vector might change with removals.
   while(index < this->objectArray.size()) {
-    if(this->objectArray[index]->deletionWasRequested())
-      this->removeGameObjectAt(index);
-    else
+    if(
+      !this->forgetGameObjectIfDeletionWasRequested(this->objectArray[index])
+    ) {
       index++;
+      continue;
+    }
+
+    freed_spawn_order = this->objectArray[index]->getSpawnOrder();
+    std::swap(this->objectArray[index], this->objectArray.back());
+    this->objectArray.pop_back();
+
+    // Picking ranks by spawn order, so the moved object takes the freed one.
+    if(index < this->objectArray.size())
+      this->objectArray[index]->setSpawnOrder(freed_spawn_order);
   }
 };
 
-void State::renderGameObjects() {
-  for(auto& game_object : this->objectArray)
-    game_object->render(this->renderer);
-};
+void State::renderGameObjects(double interpolation_factor) {
+  PROFILE_SCOPE("State::renderGameObjects");
+  unsigned long visible_objects;
 
-void State::requestDeletionOfGameObjectsAptForDeletion() noexcept {
-  for(auto& game_object : this->objectArray)
-    if(this->gameObjectIsAptForDeletion(game_object))
-      game_object->requestDeletion();
+  this->visibility_frame++;
+  visible_objects = this->markGameObjectsInsideViewport(
+    this->viewportRectangle()
+  );
+
+  if(this->component_storage_mode == ComponentStorageMode::RegistryStorageMode)
+    this->renderGameObjectsByRegistry(interpolation_factor);
+  else
+    this->renderGameObjectsByObject(interpolation_factor);
+
+  this->render_statistics.objects_drawn = visible_objects;
+  this->render_statistics.objects_culled = \
+    this->objectArray.size() - visible_objects;
 };
 
-void State::stopMusic() noexcept {
-  try {
-    this->music.stop();
-  }
-  catch(StopMusicException& stop_music_exception) {
-    std::cerr << "[State] " << stop_music_exception.what();
-    std::cerr << "[State] Ignoring last exception and resuming execution!\n";
+void State::renderGameObjectsByObject(double interpolation_factor) {
+  this->render_statistics.draw_calls = 0;
+  this->render_statistics.sprites_drawn = 0;
+
+  // Every sprite issues its own copy in this mode.
+  for(auto& game_object : this->objectArray) {
+    if(!game_object->isVisibleInFrame(this->visibility_frame))
+      continue;
+
+    game_object->render(this->renderer, interpolation_factor);
+
+    if(game_object->hasComponentType(ComponentType::SpriteComponent)) {
+      this->render_statistics.draw_calls++;
+      this->render_statistics.sprites_drawn++;
+    }
   }
 };
 
+void State::renderGameObjectsByRegistry(double interpolation_factor) {
+  this->component_registry.renderComponents(
+    this->renderer,
+    this->sprite_batch,
+    interpolation_factor,
+    this->visibility_frame
+  );
+
+  this->render_statistics.draw_calls = this->sprite_batch.getDrawCallCount();
+  this->render_statistics.sprites_drawn = this->sprite_batch.getSpriteCount();
+};
+
+void State::renderLoadingBar() noexcept {
+  SDL_Rect viewport, loading_bar;
+  Uint8 red, green, blue, alpha;
+
+  SDL_RenderGetViewport(this->renderer, &viewport);
+  SDL_GetRenderDrawColor(this->renderer, &red, &green, &blue, &alpha);
+
+  loading_bar.x = 0;
+  loading_bar.y = viewport.h - LOADING_BAR_HEIGHT;
+  loading_bar.w = (int) (viewport.w * this->getLoadingProgress());
+  loading_bar.h = LOADING_BAR_HEIGHT;
+
+  SDL_SetRenderDrawColor(this->renderer, 255, 255, 255, 255);
+  SDL_RenderFillRect(this->renderer, &loading_bar);
+  SDL_SetRenderDrawColor(this->renderer, red, green, blue, alpha);
+};
+
+void State::requestDeletionOfGameObjectsDoneDying() noexcept {
+  this->voice_manager.takeFinishedVoiceOwners(this->finished_voice_owners);
+
+  // Runs after the flush, so no later death transition undoes the requests.
+  for(GameObject* game_object : this->finished_dying_game_objects)
+    game_object->requestDeletion();
+
+  // Owners also come back from sounds that ended while they were alive.
+  for(GameObject* voice_owner : this->finished_voice_owners)
+    if(voice_owner->deathWasRecorded())
+      voice_owner->requestDeletion();
+
+  this->finished_dying_game_objects.clear();
+};
+
+void State::resolveCollisions() {
+  PROFILE_SCOPE("State::resolveCollisions");
+
+  // Runs after every update, so responses see this step's final boxes.
+  this->collision_system.update(this->objectArray);
+};
+
+void State::subscribeToInput() {
+  this->input_manager.subscribe(
+    InputEventType::KeyDownInput,
+    [this](const std::vector<InputEvent>& events) {
+      this->handleKeyDownEvents(events);
+    }
+  );
+  this->input_manager.subscribe(
+    InputEventType::MouseButtonDownInput,
+    [this](const std::vector<InputEvent>& events) {
+      this->handleMouseButtonDownEvents(events);
+    }
+  );
+  this->input_manager.subscribe(
+    InputEventType::QuitInput,
+    [this](const std::vector<InputEvent>& events) {
+      this->handleQuitEvents(events);
+    }
+  );
+};
+
+Rectangle State::viewportRectangle() const noexcept {
+  SDL_Rect viewport;
+
+  SDL_RenderGetViewport(this->renderer, &viewport);
+
+  return Rectangle(
+    VectorR2((double) 0, (double) 0),
+    (double) viewport.w,
+    (double) viewport.h
+  );
+};
+
 void State::updateGameObjects(double dt) {
-  // Use numerical indexes because vector might change with updates.
-  for(unsigned int i = 0; i < this->objectArray.size(); i++)
-    this->objectArray[i]->update(dt);
+  PROFILE_SCOPE("State::updateGameObjects");
+
+  // Previous boxes are recorded anew below, so last step's motion is void.
+  this->spatial_index.resetStepMotion();
+
+  // Structural changes wait until every parallel update has finished, and
+  // only components that touch shared state are left for the serial pass.
+  this->updateGameObjectsInParallel(dt);
+  this->job_system.runMainThreadJobs();
+
+  if(this->component_storage_mode == ComponentStorageMode::RegistryStorageMode)
+    this->updateGameObjectsByRegistry(dt);
+  else
+    this->updateGameObjectsByObject(dt);
+};
+
+void State::updateGameObjectsByObject(double dt) {
+  // Structural changes are deferred to the flush, so iterators stay valid.
+  for(auto& game_object : this->objectArray)
+    game_object->update(dt);
+};
+
+void State::updateGameObjectsByRegistry(double dt) {
+  // Only component types with per-frame work are visited at all.
+  this->component_registry.updateComponents(dt);
+};
+
+void State::updateGameObjectsInParallel(double dt) {
+  PROFILE_SCOPE("State::updateGameObjectsInParallel");
+
+  // Spawns and deletions are serial, so the array holds still in here.
+  this->job_system.parallelFor(
+    this->objectArray.size(),
+    STATE_UPDATE_CHUNK_SIZE,
+    [this, dt](size_t begin, size_t end) {
+      for(size_t index = begin; index < end; index++)
+        this->objectArray[index]->updateInParallel(dt, this->job_system);
+    }
+  );
+};
+
+void State::watchPendingSprite(GameObject* game_object, bool keeps_center) {
+  Sprite* sprite = game_object->getComponent<Sprite>();
+
+  if(sprite != nullptr && sprite->hasPendingTexture())
+    this->pending_sprite_objects.push_back({
+      .game_object = game_object,
+      .keeps_center = keeps_center
+    });
 };
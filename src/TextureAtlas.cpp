@@ -0,0 +1,163 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Texture Atlas class - Source code.
+
+// Class header include.
+#include "TextureAtlas.hpp"
+
+// Class method implementations.
+TextureAtlas::TextureAtlas(SDL_Renderer* renderer) {
+  SDL_Texture* atlas_texture = SDL_CreateTexture(
+    renderer,
+    TEXTURE_ATLAS_PIXEL_FORMAT,
+    SDL_TEXTUREACCESS_STATIC,
+    TEXTURE_ATLAS_SIZE,
+    TEXTURE_ATLAS_SIZE
+  );
+
+  if(atlas_texture != nullptr) {
+    SDL_SetTextureBlendMode(atlas_texture, SDL_BLENDMODE_BLEND);
+    this->texture = std::shared_ptr<SDL_Texture>(
+      atlas_texture,
+      &SDL_DestroyTexture
+    );
+  }
+
+  // Padding and unused space would otherwise sample undefined pixels.
+  if(this->isValid() && this->clearToTransparent() != 0)
+    this->texture.reset();
+};
+
+// Public method implementations.
+std::shared_ptr<SDL_Texture> TextureAtlas::getTexture() const noexcept {
+  return this->texture;
+};
+
+bool TextureAtlas::isValid() const noexcept {
+  return this->texture != nullptr;
+};
+
+int TextureAtlas::pack(
+  SDL_Surface* surface,
+  SDL_Rect& packed_region
+) noexcept {
+  SDL_Surface* converted_surface;
+  int upload_result;
+
+  if(!this->isValid())
+    return -1;
+
+  if(this->reserveRegion(surface->w, surface->h, packed_region) != 0)
+    return -1;
+
+  // Raw textures are stored in the atlas format and skip the conversion.
+  if(surface->format->format == TEXTURE_ATLAS_PIXEL_FORMAT)
+    return this->uploadSurface(surface, packed_region);
+
+  converted_surface = SDL_ConvertSurfaceFormat(
+    surface,
+    TEXTURE_ATLAS_PIXEL_FORMAT,
+    0
+  );
+
+  if(converted_surface == nullptr)
+    return -1;
+
+  upload_result = this->uploadSurface(converted_surface, packed_region);
+  SDL_FreeSurface(converted_surface);
+
+  return upload_result;
+};
+
+// Private method implementations.
+int TextureAtlas::clearToTransparent() noexcept {
+  int pitch = TEXTURE_ATLAS_SIZE * \
+    SDL_BYTESPERPIXEL(TEXTURE_ATLAS_PIXEL_FORMAT);
+  SDL_Rect band = {
+    .x = 0,
+    .y = 0,
+    .w = TEXTURE_ATLAS_SIZE,
+    .h = TEXTURE_ATLAS_CLEAR_BAND_ROWS
+  };
+
+  try {
+    // One zeroed band is uploaded repeatedly, instead of a whole blank page.
+    std::vector<unsigned char> transparent_band(
+      (size_t) pitch * TEXTURE_ATLAS_CLEAR_BAND_ROWS,
+      0
+    );
+
+    for(; band.y < TEXTURE_ATLAS_SIZE; band.y += band.h) {
+      band.h = std::min(
+        TEXTURE_ATLAS_CLEAR_BAND_ROWS,
+        TEXTURE_ATLAS_SIZE - band.y
+      );
+
+      if(
+        SDL_UpdateTexture(
+          this->texture.get(),
+          &band,
+          transparent_band.data(),
+          pitch
+        ) != 0
+      )
+        return -1;
+    }
+  }
+  catch(std::exception& e) {
+    return -1;
+  }
+
+  return 0;
+};
+
+int TextureAtlas::reserveRegion(
+  int width,
+  int height,
+  SDL_Rect& region
+) noexcept {
+  int padded_width = width + TEXTURE_ATLAS_PADDING;
+  int padded_height = height + TEXTURE_ATLAS_PADDING;
+
+  // Shelf packing: fill a row left to right, then open a new row below it.
+  if(this->shelf_x + padded_width > TEXTURE_ATLAS_SIZE) {
+    this->shelf_x = 0;
+    this->shelf_y += this->shelf_height;
+    this->shelf_height = 0;
+  }
+
+  if(
+    padded_width > TEXTURE_ATLAS_SIZE ||
+    this->shelf_y + padded_height > TEXTURE_ATLAS_SIZE
+  )
+    return -1;
+
+  region = {.x = this->shelf_x, .y = this->shelf_y, .w = width, .h = height};
+
+  this->shelf_x += padded_width;
+  if(padded_height > this->shelf_height)
+    this->shelf_height = padded_height;
+
+  return 0;
+};
+
+int TextureAtlas::uploadSurface(
+  SDL_Surface* surface,
+  const SDL_Rect& region
+) noexcept {
+  int upload_result;
+
+  if(SDL_LockSurface(surface) != 0)
+    return -1;
+
+  upload_result = SDL_UpdateTexture(
+    this->texture.get(),
+    &region,
+    surface->pixels,
+    surface->pitch
+  );
+  SDL_UnlockSurface(surface);
+
+  return upload_result == 0 ? 0 : -1;
+};
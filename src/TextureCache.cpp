@@ -0,0 +1,308 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Texture Cache class - Source code.
+
+// Class header include.
+#include "TextureCache.hpp"
+
+// Public method implementations.
+TextureRegion TextureCache::acquire(
+  SDL_Renderer* renderer,
+  const std::string& file
+) noexcept {
+  TextureCacheKey key = TextureCacheKey(renderer, file);
+  TextureRegion texture_region;
+  auto cached_entry = this->textures.find(key);
+
+  if(cached_entry != this->textures.end()) {
+    this->hit_count++;
+    return cached_entry->second;
+  }
+
+  this->miss_count++;
+  texture_region = this->atlas_packing ?
+    this->loadPackableTexture(renderer, file) :
+    this->loadWholeTexture(renderer, file);
+
+  // Failed loads are not cached, so a later attempt can still succeed.
+  if(texture_region.texture)
+    this->textures.emplace(key, texture_region);
+
+  return texture_region;
+};
+
+TextureRegion TextureCache::acquire(
+  SDL_Renderer* renderer,
+  const std::string& file,
+  SDL_Surface* decoded_surface
+) noexcept {
+  TextureCacheKey key = TextureCacheKey(renderer, file);
+  TextureRegion texture_region;
+  auto cached_entry = this->textures.find(key);
+
+  // The surface was decoded elsewhere and remains owned by the caller.
+  if(cached_entry != this->textures.end()) {
+    this->hit_count++;
+    return cached_entry->second;
+  }
+
+  this->miss_count++;
+  texture_region = this->atlas_packing ?
+    this->textureFromSurface(renderer, decoded_surface) :
+    TextureCache::wholeTextureRegion(
+      TextureCache::createTexture(renderer, decoded_surface)
+    );
+
+  if(texture_region.texture)
+    this->textures.emplace(key, texture_region);
+
+  return texture_region;
+};
+
+void TextureCache::clear() noexcept {
+  this->textures.clear();
+  this->atlases.clear();
+};
+
+bool TextureCache::contains(
+  SDL_Renderer* renderer,
+  const std::string& file
+) const noexcept {
+  return this->textures.count(TextureCacheKey(renderer, file)) != 0;
+};
+
+size_t TextureCache::getAtlasCount() const noexcept {
+  size_t atlas_count = 0;
+
+  for(auto& renderer_atlases : this->atlases)
+    atlas_count += renderer_atlases.second.size();
+
+  return atlas_count;
+};
+
+unsigned long TextureCache::getHitCount() const noexcept {
+  return this->hit_count;
+};
+
+unsigned long TextureCache::getMissCount() const noexcept {
+  return this->miss_count;
+};
+
+SDL_Surface* TextureCache::loadSurface(
+  const AssetArchive& asset_archive,
+  const std::string& id
+) noexcept {
+  const unsigned char* asset_data;
+  size_t asset_size;
+
+  // Raw textures skip the image decoder, reading pixels off the mapping.
+  if(
+    asset_archive.findAsset(id, asset_data, asset_size) == 0 &&
+    RawTexture::isRawTexture(asset_data, asset_size)
+  )
+    return RawTexture::loadSurface(asset_data, asset_size);
+
+  return IMG_Load_RW(asset_archive.openAsset(id), 1);
+};
+
+TextureRegion TextureCache::loadTexture(
+  SDL_Renderer* renderer,
+  const std::string& file
+) noexcept {
+  return TextureCache::wholeTextureRegion(
+    IMG_LoadTexture(renderer, file.c_str())
+  );
+};
+
+size_t TextureCache::releaseUnusedTextures() noexcept {
+  size_t released_textures = 0;
+  auto entry = this->textures.begin();
+
+  // Entries only referenced by the cache itself are no longer in use.
+  // Atlas regions are shared with their atlas, so they are never released.
+  while(entry != this->textures.end()) {
+    if(entry->second.texture.use_count() == 1) {
+      entry = this->textures.erase(entry);
+      released_textures++;
+    }
+    else
+      entry++;
+  }
+
+  return released_textures;
+};
+
+void TextureCache::setAssetArchive(
+  const AssetArchive* asset_archive
+) noexcept {
+  // Once set, cache keys are asset ids resolved through the archive.
+  this->asset_archive = asset_archive;
+};
+
+void TextureCache::setAtlasPacking(bool atlas_packing) noexcept {
+  this->atlas_packing = atlas_packing;
+};
+
+size_t TextureCache::size() const noexcept {
+  return this->textures.size();
+};
+
+// Private method implementations.
+SDL_Texture* TextureCache::createTexture(
+  SDL_Renderer* renderer,
+  SDL_Surface* surface
+) noexcept {
+  SDL_Texture* texture;
+
+  if(surface->format->format != RAW_TEXTURE_PIXEL_FORMAT)
+    return SDL_CreateTextureFromSurface(renderer, surface);
+
+  // Pixels already in the texture format need a single upload and no more.
+  texture = SDL_CreateTexture(
+    renderer,
+    RAW_TEXTURE_PIXEL_FORMAT,
+    SDL_TEXTUREACCESS_STATIC,
+    surface->w,
+    surface->h
+  );
+
+  if(texture == nullptr)
+    return nullptr;
+
+  SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+  if(
+    SDL_UpdateTexture(texture, nullptr, surface->pixels, surface->pitch) != 0
+  ) {
+    SDL_DestroyTexture(texture);
+    return nullptr;
+  }
+
+  return texture;
+};
+
+SDL_Surface* TextureCache::decodeSurface(
+  const std::string& file
+) const noexcept {
+  if(this->asset_archive != nullptr)
+    return TextureCache::loadSurface(*this->asset_archive, file);
+
+  return IMG_Load(file.c_str());
+};
+
+bool TextureCache::fitsInAtlas(const SDL_Surface* surface) noexcept {
+  return (
+    surface->w <= TEXTURE_ATLAS_MAX_PACKED_SIZE &&
+    surface->h <= TEXTURE_ATLAS_MAX_PACKED_SIZE
+  );
+};
+
+TextureRegion TextureCache::loadPackableTexture(
+  SDL_Renderer* renderer,
+  const std::string& file
+) noexcept {
+  TextureRegion texture_region;
+  SDL_Surface* surface = this->decodeSurface(file);
+
+  if(surface == nullptr)
+    return TextureRegion();
+
+  texture_region = this->textureFromSurface(renderer, surface);
+  SDL_FreeSurface(surface);
+
+  return texture_region;
+};
+
+TextureRegion TextureCache::loadWholeTexture(
+  SDL_Renderer* renderer,
+  const std::string& file
+) const noexcept {
+  TextureRegion texture_region;
+  SDL_Surface* surface;
+
+  if(this->asset_archive == nullptr)
+    return TextureCache::loadTexture(renderer, file);
+
+  surface = TextureCache::loadSurface(*this->asset_archive, file);
+
+  if(surface == nullptr)
+    return TextureRegion();
+
+  texture_region = TextureCache::wholeTextureRegion(
+    TextureCache::createTexture(renderer, surface)
+  );
+  SDL_FreeSurface(surface);
+
+  return texture_region;
+};
+
+TextureRegion TextureCache::packIntoAtlas(
+  SDL_Renderer* renderer,
+  SDL_Surface* surface
+) noexcept {
+  TextureRegion texture_region;
+
+  try {
+    std::vector<std::unique_ptr<TextureAtlas>>& renderer_atlases = \
+      this->atlases[renderer];
+
+    if(
+      renderer_atlases.empty() ||
+      renderer_atlases.back()->pack(surface, texture_region.region) != 0
+    ) {
+      // The newest atlas is full, so start a fresh page.
+      renderer_atlases.emplace_back(new TextureAtlas(renderer));
+
+      if(renderer_atlases.back()->pack(surface, texture_region.region) != 0) {
+        renderer_atlases.pop_back();
+        return TextureRegion();
+      }
+    }
+
+    texture_region.texture = renderer_atlases.back()->getTexture();
+  }
+  catch(std::exception& e) {
+    return TextureRegion();
+  }
+
+  return texture_region;
+};
+
+TextureRegion TextureCache::textureFromSurface(
+  SDL_Renderer* renderer,
+  SDL_Surface* surface
+) noexcept {
+  TextureRegion texture_region;
+
+  // Large images gain nothing from sharing a texture and get their own.
+  if(TextureCache::fitsInAtlas(surface))
+    texture_region = this->packIntoAtlas(renderer, surface);
+
+  if(!texture_region.texture)
+    texture_region = TextureCache::wholeTextureRegion(
+      TextureCache::createTexture(renderer, surface)
+    );
+
+  return texture_region;
+};
+
+TextureRegion TextureCache::wholeTextureRegion(SDL_Texture* texture) noexcept {
+  TextureRegion texture_region;
+
+  if(texture == nullptr)
+    return TextureRegion();
+
+  texture_region.texture = SDLTextureSharedPTR(texture, &SDL_DestroyTexture);
+  texture_region.region = {.x = 0, .y = 0, .w = 0, .h = 0};
+
+  SDL_QueryTexture(
+    texture,
+    nullptr,
+    nullptr,
+    &texture_region.region.w,
+    &texture_region.region.h
+  );
+
+  return texture_region;
+};
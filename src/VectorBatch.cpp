@@ -0,0 +1,438 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Vector Batch class - Source code.
+
+// Class header include.
+#include "VectorBatch.hpp"
+
+// Static member initializations.
+VectorBatchPath VectorBatch::path = VectorBatch::detectPath();
+
+// Public method implementations.
+VectorBatchPath VectorBatch::getPath() noexcept {
+  return VectorBatch::path;
+};
+
+size_t VectorBatch::markInsideRectangle(
+  const float* xs,
+  const float* ys,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags
+) noexcept {
+  size_t index = 0, inside_count = 0;
+  float left = rectangle.upper_left_corner.x;
+  float top = rectangle.upper_left_corner.y;
+  float right = left + rectangle.width;
+  float bottom = top + rectangle.height;
+
+  #ifdef VECTOR_BATCH_X86
+  if(VectorBatch::path == VectorBatchPath::AVX2Path)
+    index = VectorBatch::markInsideRectangleAVX2(
+      xs, ys, count, rectangle, flags, inside_count
+    );
+  else if(VectorBatch::path == VectorBatchPath::SSE2Path)
+    index = VectorBatch::markInsideRectangleSSE2(
+      xs, ys, count, rectangle, flags, inside_count
+    );
+  #endif
+
+  // Same strict comparisons as Rectanglef::isReferenceInsideOfSelf.
+  for(; index < count; index++) {
+    flags[index] = (
+      (xs[index] > left) & (xs[index] < right) &
+      (ys[index] > top) & (ys[index] < bottom)
+    );
+    inside_count += flags[index];
+  }
+
+  return inside_count;
+};
+
+size_t VectorBatch::markIntersectingRectangle(
+  const float* lefts,
+  const float* tops,
+  const float* rights,
+  const float* bottoms,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags
+) noexcept {
+  size_t index = 0, intersecting_count = 0;
+  float left = rectangle.upper_left_corner.x;
+  float top = rectangle.upper_left_corner.y;
+  float right = left + rectangle.width;
+  float bottom = top + rectangle.height;
+
+  #ifdef VECTOR_BATCH_X86
+  if(VectorBatch::path == VectorBatchPath::AVX2Path)
+    index = VectorBatch::markIntersectingRectangleAVX2(
+      lefts, tops, rights, bottoms, count, rectangle, flags, intersecting_count
+    );
+  else if(VectorBatch::path == VectorBatchPath::SSE2Path)
+    index = VectorBatch::markIntersectingRectangleSSE2(
+      lefts, tops, rights, bottoms, count, rectangle, flags, intersecting_count
+    );
+  #endif
+
+  // Same strict comparisons as Rectanglef::intersectsWith.
+  for(; index < count; index++) {
+    flags[index] = (
+      (lefts[index] < right) & (rights[index] > left) &
+      (tops[index] < bottom) & (bottoms[index] > top)
+    );
+    intersecting_count += flags[index];
+  }
+
+  return intersecting_count;
+};
+
+void VectorBatch::rotateClockwise(
+  float* xs,
+  float* ys,
+  size_t count,
+  float rotation_angle_in_radians
+) noexcept {
+  size_t index = 0;
+  float rotation_angle_sin = std::sin(rotation_angle_in_radians);
+  float rotation_angle_cos = std::cos(rotation_angle_in_radians);
+  float x;
+
+  #ifdef VECTOR_BATCH_X86
+  if(VectorBatch::path == VectorBatchPath::AVX2Path)
+    index = VectorBatch::rotateClockwiseAVX2(
+      xs, ys, count, rotation_angle_sin, rotation_angle_cos
+    );
+  else if(VectorBatch::path == VectorBatchPath::SSE2Path)
+    index = VectorBatch::rotateClockwiseSSE2(
+      xs, ys, count, rotation_angle_sin, rotation_angle_cos
+    );
+  #endif
+
+  for(; index < count; index++) {
+    x = xs[index];
+    xs[index] = x * rotation_angle_cos - ys[index] * rotation_angle_sin;
+    ys[index] = ys[index] * rotation_angle_cos + x * rotation_angle_sin;
+  }
+};
+
+int VectorBatch::setPath(VectorBatchPath path) noexcept {
+  if(!VectorBatch::supportsPath(path))
+    return -1;
+
+  // Meant for benchmarks, so no kernel may be running during the switch.
+  VectorBatch::path = path;
+
+  return 0;
+};
+
+bool VectorBatch::supportsPath(VectorBatchPath path) noexcept {
+  switch (path) {
+    case VectorBatchPath::ScalarPath:
+      return true;
+    #ifdef VECTOR_BATCH_X86
+    case VectorBatchPath::SSE2Path:
+      return true;
+    case VectorBatchPath::AVX2Path:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    #endif
+    default:
+      return false;
+  }
+};
+
+void VectorBatch::transform(
+  float* xs,
+  float* ys,
+  size_t count,
+  float scale,
+  const VectorR2f& offset
+) noexcept {
+  size_t index = 0;
+
+  #ifdef VECTOR_BATCH_X86
+  if(VectorBatch::path == VectorBatchPath::AVX2Path)
+    index = VectorBatch::transformAVX2(xs, ys, count, scale, offset);
+  else if(VectorBatch::path == VectorBatchPath::SSE2Path)
+    index = VectorBatch::transformSSE2(xs, ys, count, scale, offset);
+  #endif
+
+  for(; index < count; index++) {
+    xs[index] = xs[index] * scale + offset.x;
+    ys[index] = ys[index] * scale + offset.y;
+  }
+};
+
+// Private method implementations.
+VectorBatchPath VectorBatch::detectPath() noexcept {
+  if(VectorBatch::supportsPath(VectorBatchPath::AVX2Path))
+    return VectorBatchPath::AVX2Path;
+
+  if(VectorBatch::supportsPath(VectorBatchPath::SSE2Path))
+    return VectorBatchPath::SSE2Path;
+
+  return VectorBatchPath::ScalarPath;
+};
+
+// The kernels below handle whole vectors only and return how many elements
+// they covered; the public methods finish the remainder with scalar code.
+#ifdef VECTOR_BATCH_X86
+VECTOR_BATCH_AVX2_TARGET size_t VectorBatch::markInsideRectangleAVX2(
+  const float* xs,
+  const float* ys,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags,
+  size_t& inside_count
+) noexcept {
+  size_t index = 0;
+  int mask;
+  __m256 left = _mm256_set1_ps(rectangle.upper_left_corner.x);
+  __m256 top = _mm256_set1_ps(rectangle.upper_left_corner.y);
+  __m256 right = _mm256_add_ps(left, _mm256_set1_ps(rectangle.width));
+  __m256 bottom = _mm256_add_ps(top, _mm256_set1_ps(rectangle.height));
+  __m256 x, y, inside;
+
+  for(; index + 8 <= count; index += 8) {
+    x = _mm256_loadu_ps(xs + index);
+    y = _mm256_loadu_ps(ys + index);
+    inside = _mm256_and_ps(
+      _mm256_and_ps(
+        _mm256_cmp_ps(x, left, _CMP_GT_OQ),
+        _mm256_cmp_ps(x, right, _CMP_LT_OQ)
+      ),
+      _mm256_and_ps(
+        _mm256_cmp_ps(y, top, _CMP_GT_OQ),
+        _mm256_cmp_ps(y, bottom, _CMP_LT_OQ)
+      )
+    );
+    mask = _mm256_movemask_ps(inside);
+    VectorBatch::unpackMask(mask, 8, flags + index);
+    inside_count += __builtin_popcount(mask);
+  }
+
+  return index;
+};
+
+size_t VectorBatch::markInsideRectangleSSE2(
+  const float* xs,
+  const float* ys,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags,
+  size_t& inside_count
+) noexcept {
+  size_t index = 0;
+  int mask;
+  __m128 left = _mm_set1_ps(rectangle.upper_left_corner.x);
+  __m128 top = _mm_set1_ps(rectangle.upper_left_corner.y);
+  __m128 right = _mm_add_ps(left, _mm_set1_ps(rectangle.width));
+  __m128 bottom = _mm_add_ps(top, _mm_set1_ps(rectangle.height));
+  __m128 x, y, inside;
+
+  for(; index + 4 <= count; index += 4) {
+    x = _mm_loadu_ps(xs + index);
+    y = _mm_loadu_ps(ys + index);
+    inside = _mm_and_ps(
+      _mm_and_ps(_mm_cmpgt_ps(x, left), _mm_cmplt_ps(x, right)),
+      _mm_and_ps(_mm_cmpgt_ps(y, top), _mm_cmplt_ps(y, bottom))
+    );
+    mask = _mm_movemask_ps(inside);
+    VectorBatch::unpackMask(mask, 4, flags + index);
+    inside_count += __builtin_popcount(mask);
+  }
+
+  return index;
+};
+
+VECTOR_BATCH_AVX2_TARGET size_t VectorBatch::markIntersectingRectangleAVX2(
+  const float* lefts,
+  const float* tops,
+  const float* rights,
+  const float* bottoms,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags,
+  size_t& intersecting_count
+) noexcept {
+  size_t index = 0;
+  int mask;
+  __m256 left = _mm256_set1_ps(rectangle.upper_left_corner.x);
+  __m256 top = _mm256_set1_ps(rectangle.upper_left_corner.y);
+  __m256 right = _mm256_add_ps(left, _mm256_set1_ps(rectangle.width));
+  __m256 bottom = _mm256_add_ps(top, _mm256_set1_ps(rectangle.height));
+  __m256 intersecting;
+
+  for(; index + 8 <= count; index += 8) {
+    intersecting = _mm256_and_ps(
+      _mm256_and_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(lefts + index), right, _CMP_LT_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(rights + index), left, _CMP_GT_OQ)
+      ),
+      _mm256_and_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(tops + index), bottom, _CMP_LT_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(bottoms + index), top, _CMP_GT_OQ)
+      )
+    );
+    mask = _mm256_movemask_ps(intersecting);
+    VectorBatch::unpackMask(mask, 8, flags + index);
+    intersecting_count += __builtin_popcount(mask);
+  }
+
+  return index;
+};
+
+size_t VectorBatch::markIntersectingRectangleSSE2(
+  const float* lefts,
+  const float* tops,
+  const float* rights,
+  const float* bottoms,
+  size_t count,
+  const Rectanglef& rectangle,
+  unsigned char* flags,
+  size_t& intersecting_count
+) noexcept {
+  size_t index = 0;
+  int mask;
+  __m128 left = _mm_set1_ps(rectangle.upper_left_corner.x);
+  __m128 top = _mm_set1_ps(rectangle.upper_left_corner.y);
+  __m128 right = _mm_add_ps(left, _mm_set1_ps(rectangle.width));
+  __m128 bottom = _mm_add_ps(top, _mm_set1_ps(rectangle.height));
+  __m128 intersecting;
+
+  for(; index + 4 <= count; index += 4) {
+    intersecting = _mm_and_ps(
+      _mm_and_ps(
+        _mm_cmplt_ps(_mm_loadu_ps(lefts + index), right),
+        _mm_cmpgt_ps(_mm_loadu_ps(rights + index), left)
+      ),
+      _mm_and_ps(
+        _mm_cmplt_ps(_mm_loadu_ps(tops + index), bottom),
+        _mm_cmpgt_ps(_mm_loadu_ps(bottoms + index), top)
+      )
+    );
+    mask = _mm_movemask_ps(intersecting);
+    VectorBatch::unpackMask(mask, 4, flags + index);
+    intersecting_count += __builtin_popcount(mask);
+  }
+
+  return index;
+};
+
+// No fused multiply-add, so results match the scalar path bit for bit.
+VECTOR_BATCH_AVX2_TARGET size_t VectorBatch::rotateClockwiseAVX2(
+  float* xs,
+  float* ys,
+  size_t count,
+  float rotation_angle_sin,
+  float rotation_angle_cos
+) noexcept {
+  size_t index = 0;
+  __m256 sin = _mm256_set1_ps(rotation_angle_sin);
+  __m256 cos = _mm256_set1_ps(rotation_angle_cos);
+  __m256 x, y;
+
+  for(; index + 8 <= count; index += 8) {
+    x = _mm256_loadu_ps(xs + index);
+    y = _mm256_loadu_ps(ys + index);
+    _mm256_storeu_ps(
+      xs + index,
+      _mm256_sub_ps(_mm256_mul_ps(x, cos), _mm256_mul_ps(y, sin))
+    );
+    _mm256_storeu_ps(
+      ys + index,
+      _mm256_add_ps(_mm256_mul_ps(y, cos), _mm256_mul_ps(x, sin))
+    );
+  }
+
+  return index;
+};
+
+size_t VectorBatch::rotateClockwiseSSE2(
+  float* xs,
+  float* ys,
+  size_t count,
+  float rotation_angle_sin,
+  float rotation_angle_cos
+) noexcept {
+  size_t index = 0;
+  __m128 sin = _mm_set1_ps(rotation_angle_sin);
+  __m128 cos = _mm_set1_ps(rotation_angle_cos);
+  __m128 x, y;
+
+  for(; index + 4 <= count; index += 4) {
+    x = _mm_loadu_ps(xs + index);
+    y = _mm_loadu_ps(ys + index);
+    _mm_storeu_ps(
+      xs + index,
+      _mm_sub_ps(_mm_mul_ps(x, cos), _mm_mul_ps(y, sin))
+    );
+    _mm_storeu_ps(
+      ys + index,
+      _mm_add_ps(_mm_mul_ps(y, cos), _mm_mul_ps(x, sin))
+    );
+  }
+
+  return index;
+};
+
+VECTOR_BATCH_AVX2_TARGET size_t VectorBatch::transformAVX2(
+  float* xs,
+  float* ys,
+  size_t count,
+  float scale,
+  const VectorR2f& offset
+) noexcept {
+  size_t index = 0;
+  __m256 factor = _mm256_set1_ps(scale);
+  __m256 offset_x = _mm256_set1_ps(offset.x);
+  __m256 offset_y = _mm256_set1_ps(offset.y);
+  __m256 x, y;
+
+  for(; index + 8 <= count; index += 8) {
+    x = _mm256_mul_ps(_mm256_loadu_ps(xs + index), factor);
+    y = _mm256_mul_ps(_mm256_loadu_ps(ys + index), factor);
+    _mm256_storeu_ps(xs + index, _mm256_add_ps(x, offset_x));
+    _mm256_storeu_ps(ys + index, _mm256_add_ps(y, offset_y));
+  }
+
+  return index;
+};
+
+size_t VectorBatch::transformSSE2(
+  float* xs,
+  float* ys,
+  size_t count,
+  float scale,
+  const VectorR2f& offset
+) noexcept {
+  size_t index = 0;
+  __m128 factor = _mm_set1_ps(scale);
+  __m128 offset_x = _mm_set1_ps(offset.x);
+  __m128 offset_y = _mm_set1_ps(offset.y);
+
+  for(; index + 4 <= count; index += 4) {
+    _mm_storeu_ps(
+      xs + index,
+      _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(xs + index), factor), offset_x)
+    );
+    _mm_storeu_ps(
+      ys + index,
+      _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ys + index), factor), offset_y)
+    );
+  }
+
+  return index;
+};
+
+void VectorBatch::unpackMask(
+  int mask,
+  size_t lanes,
+  unsigned char* flags
+) noexcept {
+  for(size_t lane = 0; lane < lanes; lane++)
+    flags[lane] = (mask >> lane) & 1;
+};
+#endif
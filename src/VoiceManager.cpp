@@ -0,0 +1,408 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Voice Manager class - Source code.
+
+// Class header include.
+#include "VoiceManager.hpp"
+
+// Static member initializations.
+std::atomic<VoiceManager*> VoiceManager::finished_channel_listener{nullptr};
+
+// Class method implementations.
+VoiceManager::VoiceManager(
+  VoiceStealPolicy steal_policy,
+  int max_channels
+) noexcept :
+  max_channels(max_channels),
+  steal_policy(steal_policy)
+{
+  // The mixer keeps a single callback, so the newest manager takes it over.
+  VoiceManager::finished_channel_listener.store(this);
+  Mix_ChannelFinished(&VoiceManager::handleChannelFinished);
+};
+
+VoiceManager::~VoiceManager() noexcept {
+  VoiceManager* listener = this;
+
+  // Unhooking takes the audio lock, so no callback is left running after it.
+  if(
+    VoiceManager::finished_channel_listener.compare_exchange_strong(
+      listener,
+      nullptr
+    )
+  )
+    Mix_ChannelFinished(nullptr);
+};
+
+// Public method implementations.
+void VoiceManager::advanceFrame() noexcept {
+  unsigned long active_voices = 0;
+
+  this->drainFinishedChannels();
+
+  for(size_t channel = 0; channel < this->voices.size(); channel++)
+    if(this->channelHoldsVoice((int) channel))
+      active_voices++;
+
+  this->statistics.active_voices = active_voices;
+  this->statistics.peak_active_voices = std::max(
+    this->statistics.peak_active_voices,
+    active_voices
+  );
+
+  this->frame++;
+  this->frame_voice_channels.clear();
+};
+
+VoiceStealPolicy VoiceManager::getStealPolicy() const noexcept {
+  return this->steal_policy;
+};
+
+const VoiceStatistics& VoiceManager::getStatistics() const noexcept {
+  return this->statistics;
+};
+
+bool VoiceManager::isCurrentVoice(const VoiceHandle& voice) const noexcept {
+  return (
+    voice.channel >= 0 &&
+    (size_t) voice.channel < this->voices.size() &&
+    this->voices[voice.channel].generation == voice.generation &&
+    this->channelHoldsVoice(voice.channel)
+  );
+};
+
+int VoiceManager::play(
+  Mix_Chunk* chunk,
+  int priority,
+  int volume,
+  int loops,
+  GameObject* owner,
+  VoiceHandle& voice
+) noexcept {
+  int channel;
+
+  this->syncChannelCount();
+
+  // Loops outlive the frame, so only one-shots are worth merging.
+  if(
+    loops == 0 &&
+    this->mergeIntoFrameVoice(chunk, priority, owner, voice) == 0
+  )
+    return 0;
+
+  channel = Mix_PlayChannel(-1, chunk, loops);
+
+  if(channel == -1 && this->growChannels() == 0)
+    channel = Mix_PlayChannel(-1, chunk, loops);
+
+  if(channel == -1) {
+    channel = this->selectVictimChannel(priority);
+
+    // Every voice outranks this one, so it is dropped rather than failed.
+    if(channel == -1) {
+      this->statistics.dropped_voices++;
+      voice = {.channel = -1, .generation = 0};
+      return 0;
+    }
+
+    Mix_HaltChannel(channel);
+    this->statistics.stolen_voices++;
+
+    if(Mix_PlayChannel(channel, chunk, loops) == -1)
+      return -1;
+  }
+
+  this->startVoice(channel, chunk, priority, volume, loops, owner, voice);
+
+  return 0;
+};
+
+void VoiceManager::release(
+  const VoiceHandle& voice,
+  GameObject* owner
+) noexcept {
+  Voice* released_voice;
+  std::vector<GameObject*>::iterator released_owner;
+
+  if(!this->isCurrentVoice(voice))
+    return;
+
+  released_voice = &this->voices[voice.channel];
+  released_owner = std::find(
+    released_voice->owners.begin(),
+    released_voice->owners.end(),
+    owner
+  );
+
+  // A released sound stops waiting, so its owner is never handed back.
+  if(released_owner != released_voice->owners.end())
+    released_voice->owners.erase(released_owner);
+
+  // Other sounds still share this voice, so it only gets quieter.
+  if(released_voice->merged_count > 1) {
+    released_voice->merged_count--;
+    Mix_Volume(voice.channel, VoiceManager::mergedVolumeOf(*released_voice));
+    return;
+  }
+
+  // The halt is counted once its finished notification is drained.
+  Mix_HaltChannel(voice.channel);
+  released_voice->chunk = nullptr;
+};
+
+void VoiceManager::setStealPolicy(VoiceStealPolicy steal_policy) noexcept {
+  this->steal_policy = steal_policy;
+};
+
+void VoiceManager::takeFinishedVoiceOwners(
+  std::vector<GameObject*>& finished_voice_owners
+) noexcept {
+  // Swapped rather than copied, so both buffers keep their capacity.
+  finished_voice_owners.clear();
+  finished_voice_owners.swap(this->finished_voice_owners);
+};
+
+// Private method implementations.
+bool VoiceManager::channelHoldsVoice(int channel) const noexcept {
+  // Only the latest start on a channel can still be playing.
+  return (
+    this->voices[channel].chunk != nullptr &&
+    this->channel_finish_counts[channel] < this->channel_start_counts[channel]
+  );
+};
+
+void VoiceManager::drainFinishedChannels() noexcept {
+  int channel;
+
+  while(this->finished_channels.tryPop(channel)) {
+    // Channels that never started here have nothing to finish.
+    if(
+      channel < 0 ||
+      (size_t) channel >= this->channel_finish_counts.size() ||
+      this->channel_finish_counts[channel] >= \
+        this->channel_start_counts[channel]
+    )
+      continue;
+
+    this->channel_finish_counts[channel]++;
+    this->statistics.finished_voices++;
+
+    // Earlier voices on a reused channel handed their owners back on reuse.
+    if(
+      this->channel_finish_counts[channel] == \
+        this->channel_start_counts[channel]
+    )
+      this->finishVoiceOwners(channel);
+  }
+
+  if(this->finished_channels_overflowed.exchange(false)) {
+    this->statistics.finished_queue_overflows++;
+    this->resyncFinishedChannels();
+  }
+};
+
+void VoiceManager::finishVoiceOwners(int channel) noexcept {
+  std::vector<GameObject*>& owners = this->voices[channel].owners;
+
+  this->finished_voice_owners.insert(
+    this->finished_voice_owners.end(),
+    owners.begin(),
+    owners.end()
+  );
+  owners.clear();
+};
+
+int VoiceManager::growChannels() noexcept {
+  int channel_count = (int) this->voices.size();
+  int grown_channel_count = std::min(
+    std::max(2 * channel_count, 1),
+    this->max_channels
+  );
+
+  if(grown_channel_count <= channel_count)
+    return -1;
+
+  Mix_AllocateChannels(grown_channel_count);
+  this->syncChannelCount();
+
+  if((int) this->voices.size() <= channel_count)
+    return -1;
+
+  this->statistics.grown_channels += this->voices.size() - channel_count;
+
+  return 0;
+};
+
+bool VoiceManager::isBetterVictim(
+  const Voice& candidate,
+  const Voice& current_victim
+) const noexcept {
+  int candidate_volume, current_victim_volume;
+
+  // Ties always fall back to age, so the choice is stable across policies.
+  switch (this->steal_policy) {
+    case VoiceStealPolicy::StealQuietestVoice:
+      candidate_volume = VoiceManager::mergedVolumeOf(candidate);
+      current_victim_volume = VoiceManager::mergedVolumeOf(current_victim);
+
+      if(candidate_volume != current_victim_volume)
+        return candidate_volume < current_victim_volume;
+      break;
+
+    case VoiceStealPolicy::StealLowestPriorityVoice:
+      if(candidate.priority != current_victim.priority)
+        return candidate.priority < current_victim.priority;
+      break;
+
+    case VoiceStealPolicy::StealOldestVoice:
+      break;
+  }
+
+  return candidate.start_sequence < current_victim.start_sequence;
+};
+
+int VoiceManager::mergeIntoFrameVoice(
+  const Mix_Chunk* chunk,
+  int priority,
+  GameObject* owner,
+  VoiceHandle& voice
+) noexcept {
+  for(int channel : this->frame_voice_channels) {
+    Voice& frame_voice = this->voices[channel];
+
+    if(
+      frame_voice.chunk != chunk ||
+      frame_voice.start_frame != this->frame ||
+      !this->channelHoldsVoice(channel)
+    )
+      continue;
+
+    frame_voice.merged_count++;
+
+    if(owner != nullptr)
+      frame_voice.owners.push_back(owner);
+
+    frame_voice.priority = std::max(frame_voice.priority, priority);
+    Mix_Volume(channel, VoiceManager::mergedVolumeOf(frame_voice));
+
+    this->statistics.merged_voices++;
+    voice = {.channel = channel, .generation = frame_voice.generation};
+
+    return 0;
+  }
+
+  return -1;
+};
+
+void VoiceManager::resyncFinishedChannels() noexcept {
+  // Lost notifications are rebuilt by asking the mixer, once, under its lock.
+  for(size_t channel = 0; channel < this->voices.size(); channel++) {
+    this->channel_finish_counts[channel] = this->channel_start_counts[channel];
+
+    if(
+      this->channel_start_counts[channel] > 0 &&
+      Mix_Playing((int) channel)
+    )
+      this->channel_finish_counts[channel]--;
+
+    else
+      this->finishVoiceOwners((int) channel);
+  }
+};
+
+int VoiceManager::selectVictimChannel(int priority) const noexcept {
+  int victim_channel = -1;
+
+  for(size_t channel = 0; channel < this->voices.size(); channel++) {
+    const Voice& candidate = this->voices[channel];
+
+    // Channels played outside the manager are not its to steal.
+    if(
+      candidate.chunk == nullptr ||
+      candidate.priority > priority ||
+      !this->channelHoldsVoice((int) channel)
+    )
+      continue;
+
+    if(
+      victim_channel == -1 ||
+      this->isBetterVictim(candidate, this->voices[victim_channel])
+    )
+      victim_channel = (int) channel;
+  }
+
+  return victim_channel;
+};
+
+void VoiceManager::startVoice(
+  int channel,
+  const Mix_Chunk* chunk,
+  int priority,
+  int volume,
+  int loops,
+  GameObject* owner,
+  VoiceHandle& voice
+) noexcept {
+  Voice& started_voice = this->voices[channel];
+
+  // A stolen voice, or one whose finish is not drained yet, ends here.
+  this->finishVoiceOwners(channel);
+
+  started_voice = {
+    .chunk = chunk,
+    .generation = ++this->next_generation,
+    .merged_count = 1,
+    .owners = {},
+    .priority = priority,
+    .start_frame = this->frame,
+    .start_sequence = this->next_start_sequence++,
+    .volume = volume
+  };
+
+  if(owner != nullptr)
+    started_voice.owners.push_back(owner);
+
+  this->channel_start_counts[channel]++;
+  Mix_Volume(channel, VoiceManager::mergedVolumeOf(started_voice));
+
+  if(loops == 0)
+    this->frame_voice_channels.push_back(channel);
+
+  this->statistics.started_voices++;
+  voice = {.channel = channel, .generation = started_voice.generation};
+};
+
+void VoiceManager::syncChannelCount() noexcept {
+  int channel_count = Mix_AllocateChannels(-1);
+
+  // Slots follow channel numbers, so resizing leaves existing voices alone.
+  if(channel_count >= 0 && (size_t) channel_count != this->voices.size()) {
+    this->channel_finish_counts.resize(channel_count, 0);
+    this->channel_start_counts.resize(channel_count, 0);
+    this->voices.resize(channel_count, Voice());
+  }
+
+  this->statistics.allocated_channels = this->voices.size();
+};
+
+void VoiceManager::handleChannelFinished(int channel) noexcept {
+  VoiceManager* listener = VoiceManager::finished_channel_listener.load();
+
+  // Runs on the audio thread, so it may only hand the channel over.
+  if(listener == nullptr)
+    return;
+
+  if(!listener->finished_channels.tryPush(channel))
+    listener->finished_channels_overflowed.store(true);
+};
+
+int VoiceManager::mergedVolumeOf(const Voice& voice) noexcept {
+  // Copies of one sound add up like uncorrelated sources, by square root.
+  double gain = std::min(
+    std::sqrt((double) voice.merged_count),
+    VOICE_MANAGER_MERGE_GAIN_LIMIT
+  );
+
+  return std::min((int) (voice.volume * gain), MIX_MAX_VOLUME);
+};
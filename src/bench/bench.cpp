@@ -0,0 +1,714 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Benchmark main function.
+
+// Includes.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// SDL2 includes.
+#include <SDL2/SDL_events.h>
+#include <SDL2/SDL_image.h>
+#include <SDL2/SDL_mouse.h>
+#include <SDL2/SDL_rwops.h>
+#include <SDL2/SDL_stdinc.h>
+#include <SDL2/SDL_surface.h>
+#include <SDL2/SDL_timer.h>
+
+// User includes.
+#include "AssetManifest.hpp"
+#include "Collider.hpp"
+#include "CollisionSystem.hpp"
+#include "FramePacer.hpp"
+#include "Game.hpp"
+#include "RawTexture.hpp"
+
+// Macros.
+#define BENCH_COLLIDER_SIZE 32
+#define BENCH_COLLIDER_SPACING 64
+#define BENCH_COLLIDER_SPEED 120
+#define BENCH_COLLISION_MIN_OBJECTS 1000
+#define BENCH_DEFAULT_CLICKS_PER_FRAME 4
+#define BENCH_DEFAULT_ENEMY_COUNT 500
+#define BENCH_DEFAULT_FRAME_COUNT 600
+#define BENCH_MUSIC_CACHE_CAPACITY 2
+#define BENCH_MUSIC_TRACK_FILE "assets/audio/stage_state.ogg"
+#define BENCH_RANDOM_SEED 20210412
+#define BENCH_WARMUP_FRAMES 30
+
+// Enumeration definitions.
+enum BenchFunctionStatusCode {
+  BenchFunctionSuccess,
+  BenchArgumentError,
+  GameInitError,
+  GameRunError,
+  DecodeBenchError,
+  CollisionBenchError
+};
+
+// Type definitions.
+struct BenchParams {
+  unsigned long enemy_count;
+  unsigned long clicks_per_frame;
+  unsigned long frame_count;
+  ComponentStorageMode storage_mode;
+  unsigned long decode_iterations;
+  unsigned long collision_objects;
+  PresentStrategy present_strategy;
+  unsigned long music_switch_frames;
+  bool preserve_depth_order;
+};
+
+struct BenchResults {
+  std::vector<double> frame_times;
+  unsigned long long allocation_count;
+  unsigned long long allocated_bytes;
+  double cpu_time;
+  RenderStatistics render_statistics;
+  size_t game_object_count;
+  double time_to_first_frame;
+};
+
+struct BenchClickFeed {
+  std::mutex mutex;
+  std::mt19937 generator;
+  std::vector<VectorR2> spawn_points;
+  std::vector<VectorR2> respawn_points;
+  std::atomic<bool> stop_requested;
+};
+
+// Global allocation counters.
+static std::atomic<unsigned long long> allocation_count(0);
+static std::atomic<unsigned long long> allocated_bytes(0);
+
+// Global music tracks.
+// Only one track ships, but the cache still keys each of its names apart.
+static const std::vector<std::string> bench_music_tracks = {
+  STATE_MUSIC_ID,
+  "./" BENCH_MUSIC_TRACK_FILE,
+  BENCH_MUSIC_TRACK_FILE
+};
+
+// Global operator overloadings.
+void* operator new(size_t size) {
+  void* allocation = std::malloc(size == 0 ? 1 : size);
+
+  if(allocation == nullptr)
+    throw std::bad_alloc();
+
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+  return allocation;
+};
+
+void operator delete(void* allocation) noexcept {
+  std::free(allocation);
+};
+
+void operator delete(void* allocation, size_t) noexcept {
+  std::free(allocation);
+};
+
+// Function implementations.
+int parseBenchArguments(int argc, char** argv, BenchParams& bench_params) {
+  for(int index = 1; index < argc; index++) {
+    std::string argument = argv[index];
+
+    if(index + 1 >= argc)
+      return -1;
+
+    std::string value = argv[++index];
+
+    if(argument == "--enemies")
+      bench_params.enemy_count = std::stoul(value);
+    else if(argument == "--clicks")
+      bench_params.clicks_per_frame = std::stoul(value);
+    else if(argument == "--frames")
+      bench_params.frame_count = std::stoul(value);
+    else if(argument == "--mode" && value == "object")
+      bench_params.storage_mode = ComponentStorageMode::ObjectStorageMode;
+    else if(argument == "--mode" && value == "registry")
+      bench_params.storage_mode = ComponentStorageMode::RegistryStorageMode;
+    else if(argument == "--decode")
+      bench_params.decode_iterations = std::stoul(value);
+    else if(argument == "--collisions")
+      bench_params.collision_objects = std::stoul(value);
+    else if(argument == "--removal" && value == "ordered")
+      bench_params.preserve_depth_order = true;
+    else if(argument == "--removal" && value == "swap")
+      bench_params.preserve_depth_order = false;
+    else if(argument == "--music-switch")
+      bench_params.music_switch_frames = std::stoul(value);
+    else if(argument == "--present") {
+      if(
+        FramePacer::parsePresentStrategy(
+          value,
+          bench_params.present_strategy
+        ) != 0
+      )
+        return -1;
+    }
+    else
+      return -1;
+  }
+
+  if(bench_params.frame_count == 0)
+    return -1;
+
+  return 0;
+};
+
+double averageDecodeTime(
+  const std::function<SDL_Surface*()>& decode,
+  unsigned long iterations
+) {
+  double performance_frequency = (double) SDL_GetPerformanceFrequency();
+  Uint64 start_counter = SDL_GetPerformanceCounter();
+
+  for(unsigned long iteration = 0; iteration < iterations; iteration++) {
+    SDL_Surface* surface = decode();
+
+    if(surface == nullptr)
+      throw std::runtime_error("Failed to decode a texture.\n");
+
+    SDL_FreeSurface(surface);
+  }
+
+  return (SDL_GetPerformanceCounter() - start_counter) / \
+    performance_frequency / iterations;
+};
+
+double percentileOf(std::vector<double> samples, double percentile) {
+  size_t rank;
+
+  if(samples.empty())
+    return 0;
+
+  std::sort(samples.begin(), samples.end());
+  rank = (size_t) std::ceil(percentile * samples.size());
+
+  return samples[rank == 0 ? 0 : rank - 1];
+};
+
+int pushClickEvent(const VectorR2& click_coordinates) noexcept {
+  SDL_Event event;
+
+  std::memset(&event, 0, sizeof(event));
+  event.button.type = SDL_MOUSEBUTTONDOWN;
+  event.button.button = SDL_BUTTON_LEFT;
+  event.button.state = SDL_PRESSED;
+  event.button.clicks = 1;
+  event.button.x = (Sint32) click_coordinates.x;
+  event.button.y = (Sint32) click_coordinates.y;
+
+  return SDL_PushEvent(&event) == 1 ? 0 : -1;
+};
+
+VectorR2 randomCoordinates(std::mt19937& generator) {
+  std::uniform_real_distribution<double> x_distribution(0, GAME_WINDOW_WIDTH);
+  std::uniform_real_distribution<double> y_distribution(0, GAME_WINDOW_HEIGHT);
+  double x = x_distribution(generator);
+
+  return VectorR2(x, y_distribution(generator));
+};
+
+void clickRandomEnemy(BenchClickFeed& click_feed) {
+  std::lock_guard<std::mutex> click_feed_lock(click_feed.mutex);
+  size_t target;
+
+  if(click_feed.spawn_points.empty())
+    return;
+
+  // Every click lands on a known enemy, which is replaced elsewhere.
+  target = click_feed.generator() % click_feed.spawn_points.size();
+
+  if(pushClickEvent(click_feed.spawn_points[target]) != 0)
+    return;
+
+  click_feed.spawn_points[target] = randomCoordinates(click_feed.generator);
+  click_feed.respawn_points.push_back(click_feed.spawn_points[target]);
+};
+
+void feedBenchClicks(
+  BenchClickFeed& click_feed,
+  double click_interval
+) noexcept {
+  std::mt19937 generator(BENCH_RANDOM_SEED + 1);
+  std::exponential_distribution<double> next_click_delay(1.0 / click_interval);
+
+  // Clicks arrive at random moments, so some land while the loop sleeps.
+  while(!click_feed.stop_requested) {
+    std::this_thread::sleep_for(
+      std::chrono::duration<double>(next_click_delay(generator))
+    );
+
+    try {
+      clickRandomEnemy(click_feed);
+    }
+    catch(std::exception& e) {
+      std::cerr << "[Bench] " << e.what();
+      return;
+    }
+  }
+};
+
+void printBenchResults(
+  const BenchParams& bench_params,
+  const BenchResults& bench_results,
+  const State& state
+) {
+  double total_time = 0;
+  PoolStatistics game_object_pool = GameObject::poolStatistics();
+  size_t frame_count = bench_results.frame_times.size();
+  const InputLatencyStatistics& click_latency = \
+    state.getInputLatencyStatistics(InputEventType::MouseButtonDownInput);
+  const VoiceStatistics& voice_statistics = state.getVoiceStatistics();
+  const MusicStatistics& music_statistics = state.getMusicStatistics();
+
+  for(double frame_time : bench_results.frame_times)
+    total_time += frame_time;
+
+  std::cout
+    << "present_strategy: "
+    << FramePacer::presentStrategyName(bench_params.present_strategy) << "\n"
+    << "storage_mode: "
+    << (
+      bench_params.storage_mode == ComponentStorageMode::ObjectStorageMode ?
+      "object" :
+      "registry"
+    ) << "\n"
+    << "removal: "
+    << (bench_params.preserve_depth_order ? "ordered" : "swap") << "\n"
+    << "enemies: " << bench_params.enemy_count << "\n"
+    << "clicks_per_frame: " << bench_params.clicks_per_frame << "\n"
+    << "frames: " << frame_count << "\n"
+    << "frames_per_second: " << frame_count / total_time << "\n"
+    << "frame_time_p50_ms: "
+    << 1000 * percentileOf(bench_results.frame_times, 0.50) << "\n"
+    << "frame_time_p99_ms: "
+    << 1000 * percentileOf(bench_results.frame_times, 0.99) << "\n"
+    << "cpu_time_per_frame_ms: "
+    << 1000 * bench_results.cpu_time / frame_count << "\n"
+    << "allocations_per_frame: "
+    << (double) bench_results.allocation_count / frame_count << "\n"
+    << "allocated_bytes_per_frame: "
+    << (double) bench_results.allocated_bytes / frame_count << "\n"
+    << "game_objects: " << bench_results.game_object_count << "\n"
+    << "game_object_pool_high_water_mark: "
+    << game_object_pool.high_water_mark << "\n"
+    << "draw_calls: " << bench_results.render_statistics.draw_calls << "\n"
+    << "sprites_drawn: "
+    << bench_results.render_statistics.sprites_drawn << "\n"
+    << "objects_culled: "
+    << bench_results.render_statistics.objects_culled << "\n"
+    << "colliders: " << state.getCollisionStatistics().colliders << "\n"
+    << "collisions: " << state.getCollisionStatistics().collisions << "\n"
+    << "click_latency_mean_ms: "
+    << 1000 * click_latency.mean_latency << "\n"
+    << "click_latency_max_ms: "
+    << 1000 * click_latency.max_latency << "\n"
+    << "texture_cache_hits: " << state.getTextureCache().getHitCount() << "\n"
+    << "texture_cache_misses: "
+    << state.getTextureCache().getMissCount() << "\n"
+    << "voice_channels: " << voice_statistics.allocated_channels << "\n"
+    << "voices_started: " << voice_statistics.started_voices << "\n"
+    << "voices_merged: " << voice_statistics.merged_voices << "\n"
+    << "voices_stolen: " << voice_statistics.stolen_voices << "\n"
+    << "voices_dropped: " << voice_statistics.dropped_voices << "\n"
+    << "voices_finished: " << voice_statistics.finished_voices << "\n"
+    << "voices_peak_active: " << voice_statistics.peak_active_voices << "\n"
+    << "asset_load_ms: " << 1000 * state.getAssetLoadTime() << "\n"
+    << "time_to_first_frame_ms: "
+    << 1000 * bench_results.time_to_first_frame << "\n"
+    << "music_tracks: " << bench_music_tracks.size()
+    << " (aliases of " << BENCH_MUSIC_TRACK_FILE << ")\n"
+    << "music_track_switches: " << music_statistics.track_switches << "\n"
+    << "music_cache_hits: " << music_statistics.cache_hits << "\n"
+    << "music_cache_misses: " << music_statistics.cache_misses << "\n"
+    << "music_cache_evictions: " << music_statistics.cache_evictions << "\n"
+    << "music_failed_loads: " << music_statistics.failed_loads << "\n"
+    << "music_preload_ms: "
+    << 1000 * music_statistics.last_preload_time << "\n"
+    << "music_decode_ms: "
+    << 1000 * music_statistics.last_decode_time << "\n"
+    << "music_max_decode_ms: "
+    << 1000 * music_statistics.max_decode_time << "\n"
+    << "music_max_switch_ms: "
+    << 1000 * music_statistics.max_switch_time << "\n";
+};
+
+void runCollisionBenchAt(
+  const BenchParams& bench_params,
+  unsigned long object_count
+) {
+  double dt = 1.0 / GAME_SIMULATION_RATE;
+  double performance_frequency = (double) SDL_GetPerformanceFrequency();
+  double world_size = std::sqrt(object_count) * BENCH_COLLIDER_SPACING;
+  double broadphase_pairs = 0, collisions = 0;
+  std::mt19937 generator(BENCH_RANDOM_SEED);
+  std::uniform_real_distribution<double> position_distribution(0, world_size);
+  std::uniform_real_distribution<double> velocity_distribution(
+    -BENCH_COLLIDER_SPEED,
+    BENCH_COLLIDER_SPEED
+  );
+  std::vector<std::unique_ptr<GameObject>> game_objects;
+  std::vector<VectorR2> velocities;
+  std::vector<double> update_times;
+  CollisionSystem collision_system;
+
+  // Density stays the same at every size, so only the object count grows.
+  for(unsigned long index = 0; index < object_count; index++) {
+    game_objects.emplace_back(new GameObject());
+    new Collider(*game_objects.back());
+    game_objects.back()->setDimensions(
+      BENCH_COLLIDER_SIZE,
+      BENCH_COLLIDER_SIZE
+    );
+    game_objects.back()->box.upper_left_corner = VectorR2(
+      position_distribution(generator),
+      position_distribution(generator)
+    );
+    velocities.push_back(
+      VectorR2(
+        velocity_distribution(generator),
+        velocity_distribution(generator)
+      )
+    );
+  }
+
+  update_times.reserve(bench_params.frame_count);
+
+  for(
+    unsigned long frame = 0;
+    frame < BENCH_WARMUP_FRAMES + bench_params.frame_count;
+    frame++
+  ) {
+    for(unsigned long index = 0; index < object_count; index++) {
+      VectorR2& corner = game_objects[index]->box.upper_left_corner;
+
+      corner += dt * velocities[index];
+      corner.x = std::fmod(corner.x + world_size, world_size);
+      corner.y = std::fmod(corner.y + world_size, world_size);
+    }
+
+    Uint64 update_start_counter = SDL_GetPerformanceCounter();
+
+    collision_system.update(game_objects);
+
+    if(frame < BENCH_WARMUP_FRAMES)
+      continue;
+
+    update_times.push_back(
+      (SDL_GetPerformanceCounter() - update_start_counter) /
+      performance_frequency
+    );
+    broadphase_pairs += collision_system.getStatistics().broadphase_pairs;
+    collisions += collision_system.getStatistics().collisions;
+  }
+
+  std::cout
+    << "collision_" << object_count << "_update_p50_ms: "
+    << 1000 * percentileOf(update_times, 0.50) << "\n"
+    << "collision_" << object_count << "_update_p99_ms: "
+    << 1000 * percentileOf(update_times, 0.99) << "\n"
+    << "collision_" << object_count << "_broadphase_pairs_per_frame: "
+    << broadphase_pairs / update_times.size() << "\n"
+    << "collision_" << object_count << "_collisions_per_frame: "
+    << collisions / update_times.size() << "\n";
+};
+
+void runCollisionBench(const BenchParams& bench_params) {
+  unsigned long object_count = BENCH_COLLISION_MIN_OBJECTS;
+
+  // Doubling the object count shows how the cost grows with it.
+  for(; object_count < bench_params.collision_objects; object_count *= 2)
+    runCollisionBenchAt(bench_params, object_count);
+
+  runCollisionBenchAt(bench_params, bench_params.collision_objects);
+};
+
+void runDecodeBench(const BenchParams& bench_params) {
+  AssetManifest asset_manifest(STATE_ASSET_MANIFEST_FILE);
+  unsigned long iterations = bench_params.decode_iterations;
+
+  // Every format starts from memory, so only decoding itself is timed.
+  for(const AssetManifestEntry& entry : asset_manifest.getEntries()) {
+    std::ifstream image_stream(entry.file, std::ios::binary);
+    std::vector<unsigned char> image_data, raw_data, raw_lz4_data;
+
+    if(entry.kind != AssetKind::TextureAsset)
+      continue;
+
+    image_data.assign(
+      std::istreambuf_iterator<char>(image_stream),
+      std::istreambuf_iterator<char>()
+    );
+
+    if(
+      RawTexture::encodeImageFile(
+        entry.file,
+        RawTextureCompression::RawTextureUncompressed,
+        raw_data
+      ) != 0 ||
+      RawTexture::encodeImageFile(
+        entry.file,
+        RawTextureCompression::RawTextureLZ4,
+        raw_lz4_data
+      ) != 0
+    )
+      throw std::runtime_error("Failed to convert " + entry.file + ".\n");
+
+    std::cout
+      << "decode_" << entry.id << "_image_bytes: " << image_data.size() << "\n"
+      << "decode_" << entry.id << "_image_ms: "
+      << 1000 * averageDecodeTime(
+        [&image_data] {
+          return IMG_Load_RW(
+            SDL_RWFromConstMem(image_data.data(), image_data.size()),
+            1
+          );
+        },
+        iterations
+      ) << "\n"
+      << "decode_" << entry.id << "_raw_bytes: " << raw_data.size() << "\n"
+      << "decode_" << entry.id << "_raw_ms: "
+      << 1000 * averageDecodeTime(
+        [&raw_data] {
+          return RawTexture::loadSurface(raw_data.data(), raw_data.size());
+        },
+        iterations
+      ) << "\n"
+      << "decode_" << entry.id << "_raw_lz4_bytes: " << raw_lz4_data.size()
+      << "\n"
+      << "decode_" << entry.id << "_raw_lz4_ms: "
+      << 1000 * averageDecodeTime(
+        [&raw_lz4_data] {
+          return RawTexture::loadSurface(
+            raw_lz4_data.data(),
+            raw_lz4_data.size()
+          );
+        },
+        iterations
+      ) << "\n";
+  }
+};
+
+void runBenchWorkload(
+  const BenchParams& bench_params,
+  State& state,
+  Uint64 construction_start_counter,
+  BenchResults& bench_results
+) {
+  double dt = 1.0 / GAME_SIMULATION_RATE;
+  double performance_frequency = (double) SDL_GetPerformanceFrequency();
+  BenchClickFeed click_feed;
+  std::thread click_feeder;
+  FramePacer frame_pacer(GAME_FRAME_RATE, bench_params.present_strategy);
+  bool paced = \
+    bench_params.present_strategy != PresentStrategy::UncappedPresent;
+  unsigned long total_frames = BENCH_WARMUP_FRAMES + bench_params.frame_count;
+  std::mt19937 music_generator(BENCH_RANDOM_SEED);
+
+  click_feed.generator.seed(BENCH_RANDOM_SEED);
+
+  // A cache smaller than the track count exercises hits and evictions alike.
+  if(bench_params.music_switch_frames > 0)
+    state.setMusicCacheCapacity(BENCH_MUSIC_CACHE_CAPACITY);
+  click_feed.stop_requested = false;
+
+  for(unsigned long index = 0; index < bench_params.enemy_count; index++) {
+    click_feed.spawn_points.push_back(randomCoordinates(click_feed.generator));
+    state.spawnEnemyAt(click_feed.spawn_points.back());
+  }
+
+  bench_results.frame_times.reserve(bench_params.frame_count);
+
+  // Paced frames get clicks from a thread, as a player would send them.
+  if(paced && bench_params.clicks_per_frame > 0)
+    click_feeder = std::thread(
+      feedBenchClicks,
+      std::ref(click_feed),
+      1.0 / (bench_params.clicks_per_frame * GAME_FRAME_RATE)
+    );
+
+  for(unsigned long frame = 0; frame < total_frames; frame++) {
+    frame_pacer.beginFrame();
+
+    unsigned long long allocations_before = allocation_count.load();
+    unsigned long long bytes_before = allocated_bytes.load();
+    Uint64 frame_start_counter = SDL_GetPerformanceCounter();
+    Uint64 frame_end_counter;
+    std::clock_t cpu_start_clock = std::clock();
+    std::clock_t cpu_end_clock;
+
+    // Clicks go through the event queue, so input latency is measured too.
+    if(!paced)
+      for(
+        unsigned long click = 0;
+        click < bench_params.clicks_per_frame;
+        click++
+      )
+        clickRandomEnemy(click_feed);
+
+    {
+      std::lock_guard<std::mutex> click_feed_lock(click_feed.mutex);
+
+      for(const VectorR2& respawn_point : click_feed.respawn_points)
+        state.spawnEnemyAt(respawn_point);
+
+      click_feed.respawn_points.clear();
+    }
+
+    if(
+      bench_params.music_switch_frames > 0 &&
+      frame % bench_params.music_switch_frames == 0
+    )
+      state.playMusic(
+        bench_music_tracks[music_generator() % bench_music_tracks.size()]
+      );
+
+    state.update(dt);
+    state.renderAndPresent();
+
+    // Game construction included, as a player launching it would wait.
+    if(frame == 0)
+      bench_results.time_to_first_frame = (double) (
+        SDL_GetPerformanceCounter() - construction_start_counter
+      ) / performance_frequency;
+
+    // Pacing sleeps are left out, so frame times stay comparable.
+    frame_end_counter = SDL_GetPerformanceCounter();
+    cpu_end_clock = std::clock();
+    frame_pacer.endFrame();
+
+    if(frame < BENCH_WARMUP_FRAMES)
+      continue;
+
+    bench_results.frame_times.push_back(
+      (frame_end_counter - frame_start_counter) / performance_frequency
+    );
+    bench_results.cpu_time += (double) (cpu_end_clock - cpu_start_clock) / \
+      CLOCKS_PER_SEC;
+    bench_results.allocation_count += allocation_count.load() - \
+      allocations_before;
+    bench_results.allocated_bytes += allocated_bytes.load() - bytes_before;
+  }
+
+  click_feed.stop_requested = true;
+
+  if(click_feeder.joinable())
+    click_feeder.join();
+
+  bench_results.render_statistics = state.getRenderStatistics();
+  bench_results.game_object_count = state.countGameObjects();
+};
+
+// Main function.
+int main(int argc, char** argv) {
+  std::unique_ptr<Game> game;
+  GameParams game_params = Game::defaultGameParams();
+  BenchParams bench_params = {
+    .enemy_count = BENCH_DEFAULT_ENEMY_COUNT,
+    .clicks_per_frame = BENCH_DEFAULT_CLICKS_PER_FRAME,
+    .frame_count = BENCH_DEFAULT_FRAME_COUNT,
+    .storage_mode = ComponentStorageMode::RegistryStorageMode,
+    .decode_iterations = 0,
+    .collision_objects = 0,
+    .present_strategy = PresentStrategy::UncappedPresent,
+    .music_switch_frames = 0,
+    .preserve_depth_order = true
+  };
+  BenchResults bench_results = {};
+  Uint64 construction_start_counter;
+
+  try {
+    if(parseBenchArguments(argc, argv, bench_params) != 0)
+      throw std::invalid_argument("Invalid benchmark arguments.\n");
+  }
+  catch (std::exception& e) {
+    std::cerr << "[Bench] Usage: " << argv[0]
+      << " [--enemies N] [--clicks N] [--frames N] [--mode object|registry]"
+      << " [--decode N] [--collisions N]"
+      << " [--present sleep|vsync|late-latch|uncapped]"
+      << " [--music-switch N] [--removal ordered|swap]\n";
+    return BenchFunctionStatusCode::BenchArgumentError;
+  }
+
+  // Collision scaling needs no window or assets, so it runs before the game.
+  if(bench_params.collision_objects != 0) {
+    try {
+      runCollisionBench(bench_params);
+    }
+    catch (std::exception& e) {
+      std::cerr << "[Bench] " << e.what();
+      return BenchFunctionStatusCode::CollisionBenchError;
+    }
+
+    return BenchFunctionStatusCode::BenchFunctionSuccess;
+  }
+
+  game_params.headless = true;
+  game_params.loop_params.present_strategy = bench_params.present_strategy;
+
+  construction_start_counter = SDL_GetPerformanceCounter();
+
+  try {
+    game = std::unique_ptr<Game>(&Game::getInstance(game_params));
+  }
+  catch (GameInitException& game_init_exception) {
+    std::cerr << "[Bench] " << game_init_exception.what();
+    return BenchFunctionStatusCode::GameInitError;
+  }
+
+  // Texture decoding is measured on its own, apart from the frame workload.
+  if(bench_params.decode_iterations != 0) {
+    try {
+      runDecodeBench(bench_params);
+    }
+    catch (std::exception& e) {
+      std::cerr << "[Bench] " << e.what();
+      return BenchFunctionStatusCode::DecodeBenchError;
+    }
+
+    return BenchFunctionStatusCode::BenchFunctionSuccess;
+  }
+
+  try {
+    game->getState().setComponentStorageMode(bench_params.storage_mode);
+    game->getState().setPreserveDepthOrder(bench_params.preserve_depth_order);
+    runBenchWorkload(
+      bench_params,
+      game->getState(),
+      construction_start_counter,
+      bench_results
+    );
+  }
+  catch (std::exception& e) {
+    std::cerr << "[Bench] " << e.what();
+    return BenchFunctionStatusCode::GameRunError;
+  }
+
+  printBenchResults(bench_params, bench_results, game->getState());
+
+  return BenchFunctionStatusCode::BenchFunctionSuccess;
+};
@@ -0,0 +1,421 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Math micro-benchmark main function.
+
+// Includes.
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// User includes.
+#include "Rectangle.hpp"
+#include "VectorBatch.hpp"
+#include "VectorR2.hpp"
+
+// Macros.
+#define MATH_BENCH_DEFAULT_ELEMENT_COUNT 100000
+#define MATH_BENCH_DEFAULT_ITERATIONS 200
+#define MATH_BENCH_RANDOM_SEED 20210412
+#define MATH_BENCH_ROTATION_ANGLE 0.01
+#define MATH_BENCH_WORLD_SIZE 1000
+
+// Enumeration definitions.
+enum MathBenchFunctionStatusCode {
+  MathBenchFunctionSuccess,
+  MathBenchArgumentError
+};
+
+// Type definitions.
+struct LegacyVectorR2 {
+  double x;
+  double y;
+};
+
+struct LegacyRectangle {
+  LegacyVectorR2 upper_left_corner;
+  double width;
+  double height;
+};
+
+struct MathBenchParams {
+  size_t element_count;
+  unsigned long iterations;
+};
+
+struct BatchPathName {
+  VectorBatchPath path;
+  const char* name;
+};
+
+// Global benchmark data.
+static const BatchPathName batch_paths[] = {
+  {VectorBatchPath::ScalarPath, "scalar"},
+  {VectorBatchPath::SSE2Path, "sse2"},
+  {VectorBatchPath::AVX2Path, "avx2"}
+};
+
+// Results are folded in here, so the compiler cannot drop the work.
+static volatile double checksum_sink = 0;
+
+// Legacy function implementations.
+// The old out-of-line VectorR2 and Rectangle code, kept as the baseline.
+__attribute__((noinline)) LegacyVectorR2 legacyAdd(
+  const LegacyVectorR2& lhs,
+  const LegacyVectorR2& rhs
+) noexcept {
+  return LegacyVectorR2{lhs.x + rhs.x, lhs.y + rhs.y};
+};
+
+__attribute__((noinline)) LegacyVectorR2 legacyClockwiseRotatedVector(
+  const LegacyVectorR2& vector,
+  double rotation_angle_in_radians
+) noexcept {
+  double rot_angle_sin = sin(rotation_angle_in_radians);
+  double rot_angle_cos = cos(rotation_angle_in_radians);
+
+  return LegacyVectorR2{
+    vector.x * rot_angle_cos - vector.y * rot_angle_sin,
+    vector.y * rot_angle_cos + vector.x * rot_angle_sin
+  };
+};
+
+__attribute__((noinline)) bool legacyIsReferenceInsideOfSelf(
+  const LegacyRectangle& rectangle,
+  const LegacyVectorR2& reference
+) noexcept {
+  return (
+    reference.x > rectangle.upper_left_corner.x &&
+    reference.x < rectangle.upper_left_corner.x + rectangle.width &&
+    reference.y > rectangle.upper_left_corner.y &&
+    reference.y < rectangle.upper_left_corner.y + rectangle.height
+  );
+};
+
+__attribute__((noinline)) double legacyMagnitude(
+  const LegacyVectorR2& vector
+) noexcept {
+  return sqrt(pow(vector.x, 2) + pow(vector.y, 2));
+};
+
+__attribute__((noinline)) LegacyVectorR2 legacyNegate(
+  const LegacyVectorR2& operand
+) noexcept {
+  return LegacyVectorR2{-operand.x, -operand.y};
+};
+
+__attribute__((noinline)) LegacyVectorR2 legacySubtract(
+  const LegacyVectorR2& lhs,
+  const LegacyVectorR2& rhs
+) noexcept {
+  return legacyAdd(lhs, legacyNegate(rhs));
+};
+
+// Function implementations.
+template <class TWorkload>
+double nanosecondsPerElement(
+  const MathBenchParams& bench_params,
+  TWorkload workload
+) {
+  std::chrono::steady_clock::time_point start_time;
+  std::chrono::duration<double, std::nano> elapsed_time;
+
+  // One untimed pass warms the caches and the branch predictors.
+  workload();
+
+  start_time = std::chrono::steady_clock::now();
+
+  for(unsigned long iteration = 0; iteration < bench_params.iterations; \
+    iteration++)
+    workload();
+
+  elapsed_time = std::chrono::steady_clock::now() - start_time;
+
+  return elapsed_time.count() / \
+    ((double) bench_params.iterations * bench_params.element_count);
+};
+
+int parseMathBenchArguments(
+  int argc,
+  char** argv,
+  MathBenchParams& bench_params
+) {
+  for(int index = 1; index < argc; index++) {
+    std::string argument = argv[index];
+
+    if(index + 1 >= argc)
+      return -1;
+
+    std::string value = argv[++index];
+
+    if(argument == "--elements")
+      bench_params.element_count = std::stoul(value);
+    else if(argument == "--iterations")
+      bench_params.iterations = std::stoul(value);
+    else
+      return -1;
+  }
+
+  if(bench_params.element_count == 0 || bench_params.iterations == 0)
+    return -1;
+
+  return 0;
+};
+
+void printResult(const std::string& name, double nanoseconds) {
+  std::cout << name << "_ns_per_element: " << nanoseconds << "\n";
+};
+
+void runBatchPaths(
+  const std::string& name,
+  const MathBenchParams& bench_params,
+  const std::function<void()>& workload
+) {
+  VectorBatchPath detected_path = VectorBatch::getPath();
+
+  for(const BatchPathName& batch_path : batch_paths) {
+    if(VectorBatch::setPath(batch_path.path) != 0)
+      continue;
+
+    printResult(
+      name + "_batch_" + batch_path.name,
+      nanosecondsPerElement(bench_params, workload)
+    );
+  }
+
+  VectorBatch::setPath(detected_path);
+};
+
+void runMagnitudeBench(
+  const MathBenchParams& bench_params,
+  const std::vector<LegacyVectorR2>& legacy_positions,
+  const std::vector<VectorR2>& positions
+) {
+  printResult(
+    "magnitude_legacy",
+    nanosecondsPerElement(bench_params, [&]() {
+      double total = 0;
+
+      for(const LegacyVectorR2& position : legacy_positions)
+        total += legacyMagnitude(position);
+
+      checksum_sink = checksum_sink + total;
+    })
+  );
+
+  printResult(
+    "magnitude_inline",
+    nanosecondsPerElement(bench_params, [&]() {
+      double total = 0;
+
+      for(const VectorR2& position : positions)
+        total += position.magnitude();
+
+      checksum_sink = checksum_sink + total;
+    })
+  );
+};
+
+void runPointInRectangleBench(
+  const MathBenchParams& bench_params,
+  const std::vector<LegacyVectorR2>& legacy_positions,
+  const std::vector<VectorR2>& positions,
+  const std::vector<float>& xs,
+  const std::vector<float>& ys
+) {
+  const double quarter = MATH_BENCH_WORLD_SIZE / 4.0;
+  LegacyRectangle legacy_rectangle = {
+    {quarter, quarter},
+    2 * quarter,
+    2 * quarter
+  };
+  Rectangle rectangle(VectorR2(quarter, quarter), 2 * quarter, 2 * quarter);
+  std::vector<unsigned char> flags(xs.size());
+
+  printResult(
+    "point_in_rect_legacy",
+    nanosecondsPerElement(bench_params, [&]() {
+      size_t inside_count = 0;
+
+      for(const LegacyVectorR2& position : legacy_positions)
+        inside_count += legacyIsReferenceInsideOfSelf(
+          legacy_rectangle,
+          position
+        );
+
+      checksum_sink = checksum_sink + inside_count;
+    })
+  );
+
+  printResult(
+    "point_in_rect_inline",
+    nanosecondsPerElement(bench_params, [&]() {
+      size_t inside_count = 0;
+
+      for(const VectorR2& position : positions)
+        inside_count += rectangle.isReferenceInsideOfSelf(position);
+
+      checksum_sink = checksum_sink + inside_count;
+    })
+  );
+
+  runBatchPaths("point_in_rect", bench_params, [&]() {
+    checksum_sink = checksum_sink + VectorBatch::markInsideRectangle(
+      xs.data(),
+      ys.data(),
+      xs.size(),
+      Rectanglef(rectangle),
+      flags.data()
+    );
+  });
+};
+
+void runRotateBench(
+  const MathBenchParams& bench_params,
+  std::vector<LegacyVectorR2> legacy_positions,
+  std::vector<VectorR2> positions,
+  std::vector<float> xs,
+  std::vector<float> ys
+) {
+  const double rotation_angle = MATH_BENCH_ROTATION_ANGLE;
+
+  printResult(
+    "rotate_legacy",
+    nanosecondsPerElement(bench_params, [&]() {
+      for(LegacyVectorR2& position : legacy_positions)
+        position = legacyClockwiseRotatedVector(position, rotation_angle);
+
+      checksum_sink = checksum_sink + legacy_positions.back().x;
+    })
+  );
+
+  printResult(
+    "rotate_inline",
+    nanosecondsPerElement(bench_params, [&]() {
+      double rotation_angle_sin = std::sin(rotation_angle);
+      double rotation_angle_cos = std::cos(rotation_angle);
+
+      for(VectorR2& position : positions)
+        position = position.clockwiseRotatedVector(
+          rotation_angle_sin,
+          rotation_angle_cos
+        );
+
+      checksum_sink = checksum_sink + positions.back().x;
+    })
+  );
+
+  runBatchPaths("rotate", bench_params, [&]() {
+    VectorBatch::rotateClockwise(
+      xs.data(),
+      ys.data(),
+      xs.size(),
+      rotation_angle
+    );
+
+    checksum_sink = checksum_sink + xs.back();
+  });
+};
+
+void runTranslateBench(
+  const MathBenchParams& bench_params,
+  std::vector<LegacyVectorR2> legacy_positions,
+  std::vector<VectorR2> positions,
+  std::vector<float> xs,
+  std::vector<float> ys
+) {
+  LegacyVectorR2 legacy_offset = {0.5, -0.25};
+  VectorR2 offset(0.5, -0.25);
+
+  printResult(
+    "translate_legacy",
+    nanosecondsPerElement(bench_params, [&]() {
+      for(LegacyVectorR2& position : legacy_positions)
+        position = legacySubtract(position, legacy_offset);
+
+      checksum_sink = checksum_sink + legacy_positions.back().x;
+    })
+  );
+
+  printResult(
+    "translate_inline",
+    nanosecondsPerElement(bench_params, [&]() {
+      for(VectorR2& position : positions)
+        position -= offset;
+
+      checksum_sink = checksum_sink + positions.back().x;
+    })
+  );
+
+  runBatchPaths("translate", bench_params, [&]() {
+    VectorBatch::transform(
+      xs.data(),
+      ys.data(),
+      xs.size(),
+      1,
+      -VectorR2f(offset)
+    );
+
+    checksum_sink = checksum_sink + xs.back();
+  });
+};
+
+// Main function.
+int main(int argc, char** argv) {
+  MathBenchParams bench_params = {
+    .element_count = MATH_BENCH_DEFAULT_ELEMENT_COUNT,
+    .iterations = MATH_BENCH_DEFAULT_ITERATIONS
+  };
+  std::mt19937 generator(MATH_BENCH_RANDOM_SEED);
+  std::uniform_real_distribution<double> distribution(
+    0,
+    MATH_BENCH_WORLD_SIZE
+  );
+  std::vector<LegacyVectorR2> legacy_positions;
+  std::vector<VectorR2> positions;
+  std::vector<float> xs, ys;
+
+  try {
+    if(parseMathBenchArguments(argc, argv, bench_params) != 0)
+      throw std::invalid_argument("Invalid benchmark arguments.\n");
+  }
+  catch (std::exception& e) {
+    std::cerr << "[MathBench] Usage: " << argv[0]
+      << " [--elements N] [--iterations N]\n";
+    return MathBenchFunctionStatusCode::MathBenchArgumentError;
+  }
+
+  // Every variant starts from the same positions.
+  for(size_t index = 0; index < bench_params.element_count; index++) {
+    double x = distribution(generator);
+    double y = distribution(generator);
+
+    legacy_positions.push_back(LegacyVectorR2{x, y});
+    positions.push_back(VectorR2(x, y));
+    xs.push_back((float) x);
+    ys.push_back((float) y);
+  }
+
+  std::cout << "elements: " << bench_params.element_count << "\n"
+    << "iterations: " << bench_params.iterations << "\n";
+
+  runTranslateBench(bench_params, legacy_positions, positions, xs, ys);
+  runRotateBench(bench_params, legacy_positions, positions, xs, ys);
+  runPointInRectangleBench(
+    bench_params,
+    legacy_positions,
+    positions,
+    xs,
+    ys
+  );
+  runMagnitudeBench(bench_params, legacy_positions, positions);
+
+  return MathBenchFunctionStatusCode::MathBenchFunctionSuccess;
+};
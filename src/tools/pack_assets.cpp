@@ -0,0 +1,115 @@
+// Copyright (c) 2021 André Filipe Caldas Laranjeira
+// MIT License
+
+// Alien Attack - Asset packer main function.
+
+// Includes.
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// User includes.
+#include "AssetArchive.hpp"
+#include "AssetManifest.hpp"
+
+// Macros.
+#define PACK_DEFAULT_ARCHIVE_FILE "./assets/assets.pak"
+#define PACK_DEFAULT_MANIFEST_FILE "./assets/manifest.txt"
+
+// Enumeration definitions.
+enum PackFunctionStatusCode {
+  PackFunctionSuccess,
+  PackArgumentError,
+  ManifestReadError,
+  ArchiveWriteError
+};
+
+// Function implementations.
+int parsePackArguments(
+  int argc,
+  char** argv,
+  AssetPackOptions& pack_options,
+  std::string& manifest_file,
+  std::string& archive_file
+) {
+  std::vector<std::string> file_arguments;
+
+  for(int index = 1; index < argc; index++) {
+    std::string argument = argv[index];
+
+    // LZ4 only applies to raw textures, so it implies them.
+    if(argument == "--raw-textures")
+      pack_options.raw_textures = true;
+    else if(argument == "--lz4") {
+      pack_options.raw_textures = true;
+      pack_options.texture_compression = RawTextureCompression::RawTextureLZ4;
+    }
+    else if(argument.rfind("--", 0) == 0)
+      return -1;
+    else
+      file_arguments.push_back(argument);
+  }
+
+  if(file_arguments.size() > 2)
+    return -1;
+
+  if(file_arguments.size() > 0)
+    manifest_file = file_arguments[0];
+
+  if(file_arguments.size() > 1)
+    archive_file = file_arguments[1];
+
+  return 0;
+};
+
+// Main function.
+int main(int argc, char** argv) {
+  AssetManifest asset_manifest;
+  AssetPackOptions pack_options = {
+    .raw_textures = false,
+    .texture_compression = RawTextureCompression::RawTextureUncompressed
+  };
+  std::string manifest_file = PACK_DEFAULT_MANIFEST_FILE;
+  std::string archive_file = PACK_DEFAULT_ARCHIVE_FILE;
+  size_t packed_assets;
+
+  if(
+    parsePackArguments(
+      argc,
+      argv,
+      pack_options,
+      manifest_file,
+      archive_file
+    ) != 0
+  ) {
+    std::cerr << "[Pack] Usage: " << argv[0]
+      << " [--raw-textures] [--lz4] [manifest_file] [archive_file]\n";
+    return PackFunctionStatusCode::PackArgumentError;
+  }
+
+  try {
+    asset_manifest.open(manifest_file);
+  }
+  catch (AssetManifestException& asset_manifest_exception) {
+    std::cerr << "[Pack] " << asset_manifest_exception.what();
+    return PackFunctionStatusCode::ManifestReadError;
+  }
+
+  try {
+    packed_assets = AssetArchive::pack(
+      asset_manifest,
+      archive_file,
+      pack_options
+    );
+  }
+  catch (AssetArchiveException& asset_archive_exception) {
+    std::cerr << "[Pack] " << asset_archive_exception.what();
+    return PackFunctionStatusCode::ArchiveWriteError;
+  }
+
+  std::cout << "[Pack] Packed " << packed_assets << " assets into "
+    << archive_file << ".\n";
+
+  return PackFunctionStatusCode::PackFunctionSuccess;
+};